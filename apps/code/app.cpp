@@ -9,6 +9,11 @@ using namespace Escher;
 
 namespace Code {
 
+#if !PLATFORM_DEVICE
+constexpr static size_t k_pythonHeapMaxSize = CODE_MAX_HEAP_SIZE;
+static_assert(k_pythonHeapMaxSize >= App::k_pythonHeapSize, "The simulator Python heap cannot be smaller than the device's");
+#endif
+
 I18n::Message App::Descriptor::name() const {
   return I18n::Message::CodeApp;
 }
@@ -23,7 +28,8 @@ const Image * App::Descriptor::icon() const {
 
 App::Snapshot::Snapshot()
 #if EPSILON_GETOPT
-  : m_lockOnConsole(false)
+  : m_lockOnConsole(false),
+  m_pythonHeapSize(k_pythonHeapSize)
 #endif
 {
 }
@@ -64,6 +70,22 @@ void App::Snapshot::setOpt(const char * name, const char * value) {
     m_lockOnConsole = true;
     return;
   }
+  if (strcmp(name, "heap-size") == 0) {
+    // The option may be the last argument, without any value
+    if (value == nullptr) {
+      return;
+    }
+    size_t size = 0;
+    for (const char * c = value; *c >= '0' && *c <= '9'; c++) {
+      size = 10 * size + (*c - '0');
+      if (size >= k_pythonHeapMaxSize) {
+        break;
+      }
+    }
+    // The heap can neither be smaller than the device's nor exceed its buffer
+    m_pythonHeapSize = size < k_pythonHeapSize ? k_pythonHeapSize : (size > k_pythonHeapMaxSize ? k_pythonHeapMaxSize : size);
+    return;
+  }
 }
 #endif
 
@@ -116,11 +138,27 @@ bool App::textInputDidReceiveEvent(InputEventHandler * textInput, Ion::Events::E
 void App::initPythonWithUser(const void * pythonUser) {
   if (!m_pythonUser) {
     char * heap = pythonHeap();
-    MicroPython::init(heap, heap + k_pythonHeapSize);
+    MicroPython::init(heap, heap + pythonHeapSize());
   }
   m_pythonUser = pythonUser;
 }
 
+#if !PLATFORM_DEVICE
+static char sPythonHeap[k_pythonHeapMaxSize];
+
+char * App::pythonHeap() {
+  return sPythonHeap;
+}
+#endif
+
+size_t App::pythonHeapSize() const {
+#if EPSILON_GETOPT
+  return static_cast<const Snapshot *>(snapshot())->pythonHeapSize();
+#else
+  return k_pythonHeapSize;
+#endif
+}
+
 void App::deinitPython() {
   if (m_pythonUser) {
     MicroPython::deinit();
@@ -28,11 +28,13 @@ public:
     ScriptStore * scriptStore();
 #if EPSILON_GETOPT
     bool lockOnConsole() const;
+    size_t pythonHeapSize() const { return m_pythonHeapSize; }
     void setOpt(const char * name, const char * value) override;
 #endif
   private:
 #if EPSILON_GETOPT
     bool m_lockOnConsole;
+    size_t m_pythonHeapSize;
 #endif
     ScriptStore m_scriptStore;
   };
@@ -98,9 +100,13 @@ private:
   constexpr static int k_pythonHeapExtensionSize = k_pythonHeapSize - sizeof(Poincare::TreePool);
   char m_pythonHeap[k_pythonHeapExtensionSize];
 #else
-  char * pythonHeap() { return m_pythonHeap; }
-  char m_pythonHeap[k_pythonHeapSize];
+  /* On the simulator, the heap is a static buffer of CODE_MAX_HEAP_SIZE bytes
+   * so that it does not weigh on the Apps buffer. Only k_pythonHeapSize bytes
+   * are used by default, to behave like the device, but memory-hungry scripts
+   * can be given more with the --code-heap-size option. */
+  static char * pythonHeap();
 #endif
+  size_t pythonHeapSize() const;
 };
 
 }
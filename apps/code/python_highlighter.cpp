@@ -0,0 +1,383 @@
+#include "python_highlighter.h"
+#include <ion/unicode/utf8_helper.h>
+#include <python/port/port.h>
+
+/* py/parsenum.h is a C header which uses C keyword restrict.
+ * It does not exist in C++ so we define it here in order to be able to include
+ * py/parsenum.h header. */
+#ifdef __cplusplus
+#define restrict   // disable
+#endif
+
+extern "C" {
+#include "py/nlr.h"
+#include "py/lexer.h"
+#include "py/parsenum.h"
+}
+#include <assert.h>
+#include <algorithm>
+
+namespace Code {
+
+PythonHighlighter::TokenClass PythonHighlighter::TokenClassOfKind(int tokenKind) {
+  if (tokenKind == MP_TOKEN_STRING) {
+    return TokenClass::String;
+  }
+  if (tokenKind == MP_TOKEN_INTEGER || tokenKind == MP_TOKEN_FLOAT_OR_IMAG) {
+    return TokenClass::Number;
+  }
+  static_assert(MP_TOKEN_ELLIPSIS + 1 == MP_TOKEN_KW_FALSE
+      && MP_TOKEN_KW_FALSE      + 1 == MP_TOKEN_KW_NONE
+      && MP_TOKEN_KW_NONE       + 1 == MP_TOKEN_KW_TRUE
+      && MP_TOKEN_KW_TRUE       + 1 == MP_TOKEN_KW___DEBUG__
+      && MP_TOKEN_KW___DEBUG__  + 1 == MP_TOKEN_KW_AND
+      && MP_TOKEN_KW_AND        + 1 == MP_TOKEN_KW_AS
+      && MP_TOKEN_KW_AS         + 1 == MP_TOKEN_KW_ASSERT
+      /* Here there are keywords that depend on MICROPY_PY_ASYNC_AWAIT, we do
+       * not test them */
+      && MP_TOKEN_KW_BREAK      + 1 == MP_TOKEN_KW_CLASS
+      && MP_TOKEN_KW_CLASS      + 1 == MP_TOKEN_KW_CONTINUE
+      && MP_TOKEN_KW_CONTINUE   + 1 == MP_TOKEN_KW_DEF
+      && MP_TOKEN_KW_DEF        + 1 == MP_TOKEN_KW_DEL
+      && MP_TOKEN_KW_DEL        + 1 == MP_TOKEN_KW_ELIF
+      && MP_TOKEN_KW_ELIF       + 1 == MP_TOKEN_KW_ELSE
+      && MP_TOKEN_KW_ELSE       + 1 == MP_TOKEN_KW_EXCEPT
+      && MP_TOKEN_KW_EXCEPT     + 1 == MP_TOKEN_KW_FINALLY
+      && MP_TOKEN_KW_FINALLY    + 1 == MP_TOKEN_KW_FOR
+      && MP_TOKEN_KW_FOR        + 1 == MP_TOKEN_KW_FROM
+      && MP_TOKEN_KW_FROM       + 1 == MP_TOKEN_KW_GLOBAL
+      && MP_TOKEN_KW_GLOBAL     + 1 == MP_TOKEN_KW_IF
+      && MP_TOKEN_KW_IF         + 1 == MP_TOKEN_KW_IMPORT
+      && MP_TOKEN_KW_IMPORT     + 1 == MP_TOKEN_KW_IN
+      && MP_TOKEN_KW_IN         + 1 == MP_TOKEN_KW_IS
+      && MP_TOKEN_KW_IS         + 1 == MP_TOKEN_KW_LAMBDA
+      && MP_TOKEN_KW_LAMBDA     + 1 == MP_TOKEN_KW_NONLOCAL
+      && MP_TOKEN_KW_NONLOCAL   + 1 == MP_TOKEN_KW_NOT
+      && MP_TOKEN_KW_NOT        + 1 == MP_TOKEN_KW_OR
+      && MP_TOKEN_KW_OR         + 1 == MP_TOKEN_KW_PASS
+      && MP_TOKEN_KW_PASS       + 1 == MP_TOKEN_KW_RAISE
+      && MP_TOKEN_KW_RAISE      + 1 == MP_TOKEN_KW_RETURN
+      && MP_TOKEN_KW_RETURN     + 1 == MP_TOKEN_KW_TRY
+      && MP_TOKEN_KW_TRY        + 1 == MP_TOKEN_KW_WHILE
+      && MP_TOKEN_KW_WHILE      + 1 == MP_TOKEN_KW_WITH
+      && MP_TOKEN_KW_WITH       + 1 == MP_TOKEN_KW_YIELD
+      && MP_TOKEN_KW_YIELD      + 1 == MP_TOKEN_OP_ASSIGN
+      && MP_TOKEN_OP_ASSIGN     + 1 == MP_TOKEN_OP_TILDE,
+    "MP_TOKEN order changed, so Code::PythonTextArea::TokenClassOfKind might need to change too.");
+  if (tokenKind >= MP_TOKEN_KW_FALSE && tokenKind <= MP_TOKEN_KW_YIELD) {
+    return TokenClass::Keyword;
+  }
+  static_assert(MP_TOKEN_OP_TILDE       + 1 == MP_TOKEN_OP_LESS
+      && MP_TOKEN_OP_LESS               + 1 == MP_TOKEN_OP_MORE
+      && MP_TOKEN_OP_MORE               + 1 == MP_TOKEN_OP_DBL_EQUAL
+      && MP_TOKEN_OP_DBL_EQUAL          + 1 == MP_TOKEN_OP_LESS_EQUAL
+      && MP_TOKEN_OP_LESS_EQUAL         + 1 == MP_TOKEN_OP_MORE_EQUAL
+      && MP_TOKEN_OP_MORE_EQUAL         + 1 == MP_TOKEN_OP_NOT_EQUAL
+      && MP_TOKEN_OP_NOT_EQUAL          + 1 == MP_TOKEN_OP_PIPE
+      && MP_TOKEN_OP_PIPE               + 1 == MP_TOKEN_OP_CARET
+      && MP_TOKEN_OP_CARET              + 1 == MP_TOKEN_OP_AMPERSAND
+      && MP_TOKEN_OP_AMPERSAND          + 1 == MP_TOKEN_OP_DBL_LESS
+      && MP_TOKEN_OP_DBL_LESS           + 1 == MP_TOKEN_OP_DBL_MORE
+      && MP_TOKEN_OP_DBL_MORE           + 1 == MP_TOKEN_OP_PLUS
+      && MP_TOKEN_OP_PLUS               + 1 == MP_TOKEN_OP_MINUS
+      && MP_TOKEN_OP_MINUS              + 1 == MP_TOKEN_OP_STAR
+      && MP_TOKEN_OP_STAR               + 1 == MP_TOKEN_OP_AT
+      && MP_TOKEN_OP_AT                 + 1 == MP_TOKEN_OP_DBL_SLASH
+      && MP_TOKEN_OP_DBL_SLASH          + 1 == MP_TOKEN_OP_SLASH
+      && MP_TOKEN_OP_SLASH              + 1 == MP_TOKEN_OP_PERCENT
+      && MP_TOKEN_OP_PERCENT            + 1 == MP_TOKEN_OP_DBL_STAR
+      && MP_TOKEN_OP_DBL_STAR           + 1 == MP_TOKEN_DEL_PIPE_EQUAL
+      && MP_TOKEN_DEL_PIPE_EQUAL        + 1 == MP_TOKEN_DEL_CARET_EQUAL
+      && MP_TOKEN_DEL_CARET_EQUAL       + 1 == MP_TOKEN_DEL_AMPERSAND_EQUAL
+      && MP_TOKEN_DEL_AMPERSAND_EQUAL   + 1 == MP_TOKEN_DEL_DBL_LESS_EQUAL
+      && MP_TOKEN_DEL_DBL_LESS_EQUAL    + 1 == MP_TOKEN_DEL_DBL_MORE_EQUAL
+      && MP_TOKEN_DEL_DBL_MORE_EQUAL    + 1 == MP_TOKEN_DEL_PLUS_EQUAL
+      && MP_TOKEN_DEL_PLUS_EQUAL        + 1 == MP_TOKEN_DEL_MINUS_EQUAL
+      && MP_TOKEN_DEL_MINUS_EQUAL       + 1 == MP_TOKEN_DEL_STAR_EQUAL
+      && MP_TOKEN_DEL_STAR_EQUAL        + 1 == MP_TOKEN_DEL_AT_EQUAL
+      && MP_TOKEN_DEL_AT_EQUAL          + 1 == MP_TOKEN_DEL_DBL_SLASH_EQUAL
+      && MP_TOKEN_DEL_DBL_SLASH_EQUAL   + 1 == MP_TOKEN_DEL_SLASH_EQUAL
+      && MP_TOKEN_DEL_SLASH_EQUAL       + 1 == MP_TOKEN_DEL_PERCENT_EQUAL
+      && MP_TOKEN_DEL_PERCENT_EQUAL     + 1 == MP_TOKEN_DEL_DBL_STAR_EQUAL
+      && MP_TOKEN_DEL_DBL_STAR_EQUAL    + 1 == MP_TOKEN_DEL_PAREN_OPEN
+      && MP_TOKEN_DEL_PAREN_OPEN        + 1 == MP_TOKEN_DEL_PAREN_CLOSE
+      && MP_TOKEN_DEL_PAREN_CLOSE       + 1 == MP_TOKEN_DEL_BRACKET_OPEN
+      && MP_TOKEN_DEL_BRACKET_OPEN      + 1 == MP_TOKEN_DEL_BRACKET_CLOSE
+      && MP_TOKEN_DEL_BRACKET_CLOSE     + 1 == MP_TOKEN_DEL_BRACE_OPEN
+      && MP_TOKEN_DEL_BRACE_OPEN        + 1 == MP_TOKEN_DEL_BRACE_CLOSE
+      && MP_TOKEN_DEL_BRACE_CLOSE       + 1 == MP_TOKEN_DEL_COMMA
+      && MP_TOKEN_DEL_COMMA             + 1 == MP_TOKEN_DEL_COLON
+      && MP_TOKEN_DEL_COLON             + 1 == MP_TOKEN_DEL_PERIOD
+      && MP_TOKEN_DEL_PERIOD            + 1 == MP_TOKEN_DEL_SEMICOLON
+      && MP_TOKEN_DEL_SEMICOLON         + 1 == MP_TOKEN_DEL_EQUAL
+      && MP_TOKEN_DEL_EQUAL             + 1 == MP_TOKEN_DEL_MINUS_MORE,
+    "MP_TOKEN order changed, so Code::PythonTextArea::TokenClassOfKind might need to change too.");
+
+  if ((tokenKind >= MP_TOKEN_OP_TILDE && tokenKind <= MP_TOKEN_DEL_DBL_STAR_EQUAL)
+      || tokenKind == MP_TOKEN_DEL_EQUAL
+      || tokenKind == MP_TOKEN_DEL_MINUS_MORE)
+  {
+    return TokenClass::Operator;
+  }
+  return TokenClass::Default;
+}
+
+size_t PythonHighlighter::TokenLength(const mp_lexer_t * lex, const char * tokenPosition) {
+  /* The lexer stores the beginning of the current token and of the next token,
+   * so we just use that. */
+  if (lex->line > 1) {
+    /* The next token is on the next line, so we cannot just make the difference
+     * of the columns. */
+    return UTF8Helper::CodePointSearch(tokenPosition, '\n') - tokenPosition;
+  }
+  return lex->column - lex->tok_column;
+}
+
+/* PythonHighlighter::HighlightedLine */
+
+void PythonHighlighter::HighlightedLine::reset(int line, size_t length) {
+  m_line = line;
+  m_length = length;
+  m_numberOfTokens = 0;
+  m_overflow = false;
+}
+
+void PythonHighlighter::HighlightedLine::addToken(const char * start, const char * end, TokenClass tokenClass) {
+  if (m_numberOfTokens >= k_maxNumberOfTokens) {
+    // The line has too many tokens to be cached, it will be lexed each time
+    m_overflow = true;
+    return;
+  }
+  assert(start >= m_lineStart && end >= start && end <= m_lineStart + m_length);
+  m_tokens[m_numberOfTokens++] = {
+    static_cast<uint16_t>(start - m_lineStart),
+    static_cast<uint16_t>(end - m_lineStart),
+    tokenClass};
+}
+
+void PythonHighlighter::HighlightedLine::replay(const char * text, TokenSink * sink) const {
+  assert(!m_overflow);
+  for (int i = 0; i < m_numberOfTokens; i++) {
+    sink->addToken(text + m_tokens[i].start, text + m_tokens[i].end, m_tokens[i].tokenClass);
+  }
+}
+
+/* PythonHighlighter */
+
+PythonHighlighter::PythonHighlighter() :
+  m_numberOfValidLineStates(1)
+{
+  invalidateFromLine(0);
+}
+
+void PythonHighlighter::highlightLine(const char * text, int line, const char * lineStart, size_t length, TokenSink * sink) const {
+  HighlightedLine * highlightedLine = m_highlightedLines + (line % k_numberOfHighlightedLines);
+  if (highlightedLine->isValidFor(line, length)) {
+    highlightedLine->replay(lineStart, sink);
+    return;
+  }
+  LineState stateAtBeginning = stateAtBeginningOfLine(text, line, lineStart);
+  LineState stateAtEnd;
+  highlightedLine->reset(line, length);
+  highlightedLine->setLineStart(lineStart);
+  if (!lexLine(lineStart, length, stateAtBeginning, highlightedLine, &stateAtEnd)) {
+    // Uncaught exception
+    highlightedLine->invalidate();
+    sink->addToken(lineStart, lineStart + length, TokenClass::Default);
+    return;
+  }
+  if (line + 1 == m_numberOfValidLineStates && line + 1 < k_maxNumberOfLineStates) {
+    setLineState(line + 1, stateAtEnd);
+    m_numberOfValidLineStates++;
+  }
+  if (highlightedLine->isValidFor(line, length)) {
+    highlightedLine->replay(lineStart, sink);
+  } else {
+    // Too many tokens to be cached, lex the line again for the sink
+    highlightedLine->invalidate();
+    lexLine(lineStart, length, stateAtBeginning, sink, &stateAtEnd);
+  }
+}
+
+bool PythonHighlighter::didModifyLine(int line, const char * lineStart, bool canLex) {
+  bool nextLineStateWasValid = line + 1 < m_numberOfValidLineStates;
+  LineState previousNextLineState = nextLineStateWasValid ? lineState(line + 1) : LineState::Code;
+  invalidateFromLine(line);
+  if (!nextLineStateWasValid || !canLex) {
+    return false;
+  }
+  NullTokenSink nullSink;
+  LineState nextLineState;
+  size_t lineLength = UTF8Helper::CodePointSearch(lineStart, '\n') - lineStart;
+  return lexLine(lineStart, lineLength, lineState(line), &nullSink, &nextLineState) && nextLineState != previousNextLineState;
+}
+
+void PythonHighlighter::invalidateFromLine(int line) {
+  for (int i = 0; i < k_numberOfHighlightedLines; i++) {
+    if (m_highlightedLines[i].line() >= line) {
+      m_highlightedLines[i].invalidate();
+    }
+  }
+  /* The state at the beginning of the modified line only depends on the
+   * previous lines, so it remains valid. */
+  m_numberOfValidLineStates = std::min(m_numberOfValidLineStates, line + 1);
+  if (line == 0) {
+    setLineState(0, LineState::Code);
+  }
+}
+
+PythonHighlighter::LineState PythonHighlighter::lineState(int line) const {
+  assert(line >= 0 && line < m_numberOfValidLineStates);
+  constexpr int k_bitsPerState = 8 / k_lineStatesPerByte;
+  int shift = (line % k_lineStatesPerByte) * k_bitsPerState;
+  return static_cast<LineState>((m_lineStates[line / k_lineStatesPerByte] >> shift) & ((1 << k_bitsPerState) - 1));
+}
+
+void PythonHighlighter::setLineState(int line, LineState state) const {
+  assert(line >= 0 && line < k_maxNumberOfLineStates);
+  constexpr int k_bitsPerState = 8 / k_lineStatesPerByte;
+  int shift = (line % k_lineStatesPerByte) * k_bitsPerState;
+  uint8_t * byte = m_lineStates + line / k_lineStatesPerByte;
+  *byte = (*byte & ~(((1 << k_bitsPerState) - 1) << shift)) | (static_cast<uint8_t>(state) << shift);
+}
+
+PythonHighlighter::LineState PythonHighlighter::stateAtBeginningOfLine(const char * text, int line, const char * lineStart) const {
+  if (line >= k_maxNumberOfLineStates) {
+    // Lines this far are not tracked, lex them independently
+    return LineState::Code;
+  }
+  if (line < m_numberOfValidLineStates) {
+    return lineState(line);
+  }
+  /* Lex the lines between the last line with a known state and this one. Only
+   * the state at the end of each line is needed. */
+  const char * start = lineStart;
+  for (int i = m_numberOfValidLineStates; i <= line; i++) {
+    assert(start > text && *(start - 1) == '\n');
+    start--;
+    while (start > text && *(start - 1) != '\n') {
+      start--;
+    }
+  }
+  NullTokenSink nullSink;
+  while (m_numberOfValidLineStates <= line) {
+    int previousLine = m_numberOfValidLineStates - 1;
+    size_t lineLength = UTF8Helper::CodePointSearch(start, '\n') - start;
+    LineState state;
+    if (!lexLine(start, lineLength, lineState(previousLine), &nullSink, &state)) {
+      return LineState::Code;
+    }
+    setLineState(previousLine + 1, state);
+    m_numberOfValidLineStates++;
+    start += lineLength + 1;
+  }
+  assert(start == lineStart);
+  return lineState(line);
+}
+
+static const char * EndOfLongString(const char * text, const char * end, char quote) {
+  // Return the end of the closing quotes, or nullptr if the string continues
+  int numberOfQuotes = 0;
+  for (const char * c = text; c < end; c++) {
+    if (*c == '\\') {
+      numberOfQuotes = 0;
+      c++;
+    } else if (*c == quote) {
+      if (++numberOfQuotes == 3) {
+        return c + 1;
+      }
+    } else {
+      numberOfQuotes = 0;
+    }
+  }
+  return nullptr;
+}
+
+bool PythonHighlighter::lexLine(const char * text, size_t byteLength, LineState stateAtBeginning, TokenSink * sink, LineState * stateAtEnd) const {
+  const char * lineEnd = text + byteLength;
+  *stateAtEnd = LineState::Code;
+  const char * codeStart = text;
+  if (stateAtBeginning != LineState::Code) {
+    // The line starts inside a triple-quoted string
+    const char * stringEnd = EndOfLongString(text, lineEnd, stateAtBeginning == LineState::InSingleQuotesLongString ? '\'' : '"');
+    if (stringEnd == nullptr) {
+      sink->addToken(text, lineEnd, TokenClass::MultilineString);
+      *stateAtEnd = stateAtBeginning;
+      return true;
+    }
+    sink->addToken(text, stringEnd, TokenClass::MultilineString);
+    codeStart = stringEnd;
+  }
+
+  /* We're using the MicroPython lexer to do syntax highlighting on a per-line
+   * basis. This can work, however the MicroPython lexer won't accept a line
+   * starting with a whitespace. So we're discarding leading whitespaces
+   * beforehand. */
+  const char * firstNonSpace = UTF8Helper::NotCodePointSearch(codeStart, ' ');
+  if (firstNonSpace >= lineEnd || UTF8Helper::CodePointIs(firstNonSpace, UCodePointNull)) {
+    return true;
+  }
+
+  nlr_buf_t nlr;
+  if (nlr_push(&nlr) == 0) {
+    mp_lexer_t * lex = mp_lexer_new_from_str_len(0, firstNonSpace, lineEnd - firstNonSpace, 0);
+
+    const char * tokenFrom = firstNonSpace;
+    size_t tokenLength = 0;
+    while (lex->tok_kind != MP_TOKEN_NEWLINE && lex->tok_kind != MP_TOKEN_END) {
+      tokenFrom = firstNonSpace + lex->tok_column - 1;
+      tokenLength = TokenLength(lex, tokenFrom);
+      TokenClass tokenClass = TokenClassOfKind(lex->tok_kind);
+
+      if (tokenClass == TokenClass::Number) {
+        /* Check if the token can actually be parsed because lexer might label
+         * tokens that cannot be parsed as integer or float */
+        nlr_buf_t nlrNumberColorParse;
+        if (nlr_push(&nlrNumberColorParse) == 0) {
+          /* Use ex->vstr.len instead of tokenLength because it translates
+           * escaped chars as the interpreter would do. */
+          if (lex->tok_kind == MP_TOKEN_INTEGER) {
+            mp_parse_num_integer(tokenFrom, lex->vstr.len, 0, NULL);
+          } else {
+            mp_parse_num_decimal(tokenFrom, lex->vstr.len, true, false, NULL);
+          }
+          nlr_pop();
+        } else {
+          // Parsing raised an exception, use DefaultColor.
+          tokenClass = TokenClass::Default;
+        }
+      } else if (lex->tok_kind == MP_TOKEN_LONELY_STRING_OPEN) {
+        // An unterminated triple-quoted string continues on the next line
+        const char * quote = tokenFrom;
+        while (*quote != '\'' && *quote != '"') {
+          // Skip the string prefix
+          quote++;
+        }
+        if (quote + 2 < lineEnd && quote[1] == quote[0] && quote[2] == quote[0]) {
+          tokenClass = TokenClass::String;
+          *stateAtEnd = quote[0] == '\'' ? LineState::InSingleQuotesLongString : LineState::InDoubleQuotesLongString;
+        }
+      }
+      sink->addToken(tokenFrom, tokenFrom + tokenLength, tokenClass);
+
+      mp_lexer_to_next(lex);
+      }
+
+    tokenFrom += tokenLength;
+
+    // Even if the token is being autocompleted, use CommentColor
+    if (tokenFrom < lineEnd) {
+      sink->addToken(tokenFrom, lineEnd, TokenClass::Comment);
+    }
+
+    mp_lexer_free(lex);
+    nlr_pop();
+    return true;
+  }
+  // Uncaught exception
+  MicroPython::ExecutionEnvironment::HandleExceptionSilently();
+  *stateAtEnd = LineState::Code;
+  return false;
+}
+
+}
@@ -0,0 +1,106 @@
+#ifndef CODE_PYTHON_HIGHLIGHTER_H
+#define CODE_PYTHON_HIGHLIGHTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct _mp_lexer_t;
+
+namespace Code {
+
+/* PythonHighlighter splits the lines of a Python text into classes of tokens,
+ * with the MicroPython lexer.
+ * Lexing a line is expensive, so the token classes of the lines that were last
+ * highlighted are kept and reused until the text is modified. Lines are lexed
+ * independently, except for triple-quoted strings which can span several
+ * lines: the lexer state at the beginning of each line is kept as well, so
+ * that a line can be lexed without lexing the whole text again. Any
+ * modification of the text invalidates the cache from the modified line
+ * onward. */
+
+class PythonHighlighter {
+public:
+  enum class TokenClass : uint8_t {
+    Default,
+    Keyword,
+    Number,
+    Operator,
+    String,
+    /* Part of a triple-quoted string started on a previous line. Contrary to
+     * other tokens, it is not recolored when autocompleting. */
+    MultilineString,
+    Comment
+  };
+  class TokenSink {
+  public:
+    virtual void addToken(const char * start, const char * end, TokenClass tokenClass) = 0;
+  };
+
+  // Length of the token the lexer is on, which starts at tokenPosition
+  static size_t TokenLength(const _mp_lexer_t * lex, const char * tokenPosition);
+
+  PythonHighlighter();
+  /* Give sink the tokens of the line-th line of text, which starts at lineStart
+   * and is length bytes long. MicroPython must be initialized. */
+  void highlightLine(const char * text, int line, const char * lineStart, size_t length, TokenSink * sink) const;
+  /* Invalidate the cache from the modified line. If canLex, return true when
+   * the modification opens or closes a triple-quoted string, in which case all
+   * the following lines need to be highlighted again. */
+  bool didModifyLine(int line, const char * lineStart, bool canLex);
+
+private:
+  enum class LineState : uint8_t {
+    Code = 0,
+    InSingleQuotesLongString,
+    InDoubleQuotesLongString
+  };
+  class NullTokenSink : public TokenSink {
+  public:
+    void addToken(const char * start, const char * end, TokenClass tokenClass) override {}
+  };
+  class HighlightedLine : public TokenSink {
+  public:
+    constexpr static int k_maxNumberOfTokens = 24;
+    HighlightedLine() : m_line(-1) {}
+    void reset(int line, size_t length);
+    void invalidate() { m_line = -1; }
+    bool isValidFor(int line, size_t length) const { return m_line == line && m_length == length && !m_overflow; }
+    int line() const { return m_line; }
+    void addToken(const char * start, const char * end, TokenClass tokenClass) override;
+    void replay(const char * text, TokenSink * sink) const;
+    void setLineStart(const char * text) { m_lineStart = text; }
+  private:
+    struct Token {
+      uint16_t start;
+      uint16_t end;
+      TokenClass tokenClass;
+    };
+    const char * m_lineStart; // Only valid while the line is being lexed
+    int16_t m_line;
+    uint16_t m_length;
+    uint8_t m_numberOfTokens;
+    bool m_overflow;
+    Token m_tokens[k_maxNumberOfTokens];
+  };
+  /* Lines are mapped on cached slots with their index modulo the number of
+   * slots, so consecutive visible lines never evict each other. */
+  constexpr static int k_numberOfHighlightedLines = 16;
+  constexpr static int k_maxNumberOfLineStates = 1024;
+  constexpr static int k_lineStatesPerByte = 4;
+
+  static TokenClass TokenClassOfKind(int tokenKind);
+  void invalidateFromLine(int line);
+  LineState lineState(int line) const;
+  void setLineState(int line, LineState state) const;
+  LineState stateAtBeginningOfLine(const char * text, int line, const char * lineStart) const;
+  bool lexLine(const char * text, size_t length, LineState stateAtBeginning, TokenSink * sink, LineState * stateAtEnd) const;
+
+  mutable HighlightedLine m_highlightedLines[k_numberOfHighlightedLines];
+  // States at the beginning of lines [0, m_numberOfValidLineStates) are valid
+  mutable int m_numberOfValidLineStates;
+  mutable uint8_t m_lineStates[k_maxNumberOfLineStates / k_lineStatesPerByte];
+};
+
+}
+
+#endif
@@ -4,17 +4,9 @@
 #include <ion/unicode/utf8_helper.h>
 #include <python/port/port.h>
 
-/* py/parsenum.h is a C header which uses C keyword restrict.
- * It does not exist in C++ so we define it here in order to be able to include
- * py/parsenum.h header. */
-#ifdef __cplusplus
-#define restrict   // disable
-#endif
-
 extern "C" {
 #include "py/nlr.h"
 #include "py/lexer.h"
-#include "py/parsenum.h"
 }
 #include <stdlib.h>
 #include <algorithm>
@@ -34,118 +26,23 @@ constexpr KDColor BackgroundColor = KDColorWhite;
 constexpr KDColor HighlightColor = Palette::Select;
 constexpr KDColor DefaultColor = KDColorBlack;
 
-static inline KDColor TokenColor(mp_token_kind_t tokenKind) {
-  if (tokenKind == MP_TOKEN_STRING) {
-    return StringColor;
-  }
-  if (tokenKind == MP_TOKEN_INTEGER || tokenKind == MP_TOKEN_FLOAT_OR_IMAG) {
-    return NumberColor;
-  }
-  static_assert(MP_TOKEN_ELLIPSIS + 1 == MP_TOKEN_KW_FALSE
-      && MP_TOKEN_KW_FALSE      + 1 == MP_TOKEN_KW_NONE
-      && MP_TOKEN_KW_NONE       + 1 == MP_TOKEN_KW_TRUE
-      && MP_TOKEN_KW_TRUE       + 1 == MP_TOKEN_KW___DEBUG__
-      && MP_TOKEN_KW___DEBUG__  + 1 == MP_TOKEN_KW_AND
-      && MP_TOKEN_KW_AND        + 1 == MP_TOKEN_KW_AS
-      && MP_TOKEN_KW_AS         + 1 == MP_TOKEN_KW_ASSERT
-      /* Here there are keywords that depend on MICROPY_PY_ASYNC_AWAIT, we do
-       * not test them */
-      && MP_TOKEN_KW_BREAK      + 1 == MP_TOKEN_KW_CLASS
-      && MP_TOKEN_KW_CLASS      + 1 == MP_TOKEN_KW_CONTINUE
-      && MP_TOKEN_KW_CONTINUE   + 1 == MP_TOKEN_KW_DEF
-      && MP_TOKEN_KW_DEF        + 1 == MP_TOKEN_KW_DEL
-      && MP_TOKEN_KW_DEL        + 1 == MP_TOKEN_KW_ELIF
-      && MP_TOKEN_KW_ELIF       + 1 == MP_TOKEN_KW_ELSE
-      && MP_TOKEN_KW_ELSE       + 1 == MP_TOKEN_KW_EXCEPT
-      && MP_TOKEN_KW_EXCEPT     + 1 == MP_TOKEN_KW_FINALLY
-      && MP_TOKEN_KW_FINALLY    + 1 == MP_TOKEN_KW_FOR
-      && MP_TOKEN_KW_FOR        + 1 == MP_TOKEN_KW_FROM
-      && MP_TOKEN_KW_FROM       + 1 == MP_TOKEN_KW_GLOBAL
-      && MP_TOKEN_KW_GLOBAL     + 1 == MP_TOKEN_KW_IF
-      && MP_TOKEN_KW_IF         + 1 == MP_TOKEN_KW_IMPORT
-      && MP_TOKEN_KW_IMPORT     + 1 == MP_TOKEN_KW_IN
-      && MP_TOKEN_KW_IN         + 1 == MP_TOKEN_KW_IS
-      && MP_TOKEN_KW_IS         + 1 == MP_TOKEN_KW_LAMBDA
-      && MP_TOKEN_KW_LAMBDA     + 1 == MP_TOKEN_KW_NONLOCAL
-      && MP_TOKEN_KW_NONLOCAL   + 1 == MP_TOKEN_KW_NOT
-      && MP_TOKEN_KW_NOT        + 1 == MP_TOKEN_KW_OR
-      && MP_TOKEN_KW_OR         + 1 == MP_TOKEN_KW_PASS
-      && MP_TOKEN_KW_PASS       + 1 == MP_TOKEN_KW_RAISE
-      && MP_TOKEN_KW_RAISE      + 1 == MP_TOKEN_KW_RETURN
-      && MP_TOKEN_KW_RETURN     + 1 == MP_TOKEN_KW_TRY
-      && MP_TOKEN_KW_TRY        + 1 == MP_TOKEN_KW_WHILE
-      && MP_TOKEN_KW_WHILE      + 1 == MP_TOKEN_KW_WITH
-      && MP_TOKEN_KW_WITH       + 1 == MP_TOKEN_KW_YIELD
-      && MP_TOKEN_KW_YIELD      + 1 == MP_TOKEN_OP_ASSIGN
-      && MP_TOKEN_OP_ASSIGN     + 1 == MP_TOKEN_OP_TILDE,
-    "MP_TOKEN order changed, so Code::PythonTextArea::TokenColor might need to change too.");
-  if (tokenKind >= MP_TOKEN_KW_FALSE && tokenKind <= MP_TOKEN_KW_YIELD) {
+KDColor PythonTextArea::ContentView::TokenClassColor(TokenClass tokenClass) {
+  switch (tokenClass) {
+  case TokenClass::Keyword:
     return KeywordColor;
-  }
-  static_assert(MP_TOKEN_OP_TILDE       + 1 == MP_TOKEN_OP_LESS
-      && MP_TOKEN_OP_LESS               + 1 == MP_TOKEN_OP_MORE
-      && MP_TOKEN_OP_MORE               + 1 == MP_TOKEN_OP_DBL_EQUAL
-      && MP_TOKEN_OP_DBL_EQUAL          + 1 == MP_TOKEN_OP_LESS_EQUAL
-      && MP_TOKEN_OP_LESS_EQUAL         + 1 == MP_TOKEN_OP_MORE_EQUAL
-      && MP_TOKEN_OP_MORE_EQUAL         + 1 == MP_TOKEN_OP_NOT_EQUAL
-      && MP_TOKEN_OP_NOT_EQUAL          + 1 == MP_TOKEN_OP_PIPE
-      && MP_TOKEN_OP_PIPE               + 1 == MP_TOKEN_OP_CARET
-      && MP_TOKEN_OP_CARET              + 1 == MP_TOKEN_OP_AMPERSAND
-      && MP_TOKEN_OP_AMPERSAND          + 1 == MP_TOKEN_OP_DBL_LESS
-      && MP_TOKEN_OP_DBL_LESS           + 1 == MP_TOKEN_OP_DBL_MORE
-      && MP_TOKEN_OP_DBL_MORE           + 1 == MP_TOKEN_OP_PLUS
-      && MP_TOKEN_OP_PLUS               + 1 == MP_TOKEN_OP_MINUS
-      && MP_TOKEN_OP_MINUS              + 1 == MP_TOKEN_OP_STAR
-      && MP_TOKEN_OP_STAR               + 1 == MP_TOKEN_OP_AT
-      && MP_TOKEN_OP_AT                 + 1 == MP_TOKEN_OP_DBL_SLASH
-      && MP_TOKEN_OP_DBL_SLASH          + 1 == MP_TOKEN_OP_SLASH
-      && MP_TOKEN_OP_SLASH              + 1 == MP_TOKEN_OP_PERCENT
-      && MP_TOKEN_OP_PERCENT            + 1 == MP_TOKEN_OP_DBL_STAR
-      && MP_TOKEN_OP_DBL_STAR           + 1 == MP_TOKEN_DEL_PIPE_EQUAL
-      && MP_TOKEN_DEL_PIPE_EQUAL        + 1 == MP_TOKEN_DEL_CARET_EQUAL
-      && MP_TOKEN_DEL_CARET_EQUAL       + 1 == MP_TOKEN_DEL_AMPERSAND_EQUAL
-      && MP_TOKEN_DEL_AMPERSAND_EQUAL   + 1 == MP_TOKEN_DEL_DBL_LESS_EQUAL
-      && MP_TOKEN_DEL_DBL_LESS_EQUAL    + 1 == MP_TOKEN_DEL_DBL_MORE_EQUAL
-      && MP_TOKEN_DEL_DBL_MORE_EQUAL    + 1 == MP_TOKEN_DEL_PLUS_EQUAL
-      && MP_TOKEN_DEL_PLUS_EQUAL        + 1 == MP_TOKEN_DEL_MINUS_EQUAL
-      && MP_TOKEN_DEL_MINUS_EQUAL       + 1 == MP_TOKEN_DEL_STAR_EQUAL
-      && MP_TOKEN_DEL_STAR_EQUAL        + 1 == MP_TOKEN_DEL_AT_EQUAL
-      && MP_TOKEN_DEL_AT_EQUAL          + 1 == MP_TOKEN_DEL_DBL_SLASH_EQUAL
-      && MP_TOKEN_DEL_DBL_SLASH_EQUAL   + 1 == MP_TOKEN_DEL_SLASH_EQUAL
-      && MP_TOKEN_DEL_SLASH_EQUAL       + 1 == MP_TOKEN_DEL_PERCENT_EQUAL
-      && MP_TOKEN_DEL_PERCENT_EQUAL     + 1 == MP_TOKEN_DEL_DBL_STAR_EQUAL
-      && MP_TOKEN_DEL_DBL_STAR_EQUAL    + 1 == MP_TOKEN_DEL_PAREN_OPEN
-      && MP_TOKEN_DEL_PAREN_OPEN        + 1 == MP_TOKEN_DEL_PAREN_CLOSE
-      && MP_TOKEN_DEL_PAREN_CLOSE       + 1 == MP_TOKEN_DEL_BRACKET_OPEN
-      && MP_TOKEN_DEL_BRACKET_OPEN      + 1 == MP_TOKEN_DEL_BRACKET_CLOSE
-      && MP_TOKEN_DEL_BRACKET_CLOSE     + 1 == MP_TOKEN_DEL_BRACE_OPEN
-      && MP_TOKEN_DEL_BRACE_OPEN        + 1 == MP_TOKEN_DEL_BRACE_CLOSE
-      && MP_TOKEN_DEL_BRACE_CLOSE       + 1 == MP_TOKEN_DEL_COMMA
-      && MP_TOKEN_DEL_COMMA             + 1 == MP_TOKEN_DEL_COLON
-      && MP_TOKEN_DEL_COLON             + 1 == MP_TOKEN_DEL_PERIOD
-      && MP_TOKEN_DEL_PERIOD            + 1 == MP_TOKEN_DEL_SEMICOLON
-      && MP_TOKEN_DEL_SEMICOLON         + 1 == MP_TOKEN_DEL_EQUAL
-      && MP_TOKEN_DEL_EQUAL             + 1 == MP_TOKEN_DEL_MINUS_MORE,
-    "MP_TOKEN order changed, so Code::PythonTextArea::TokenColor might need to change too.");
-
-  if ((tokenKind >= MP_TOKEN_OP_TILDE && tokenKind <= MP_TOKEN_DEL_DBL_STAR_EQUAL)
-      || tokenKind == MP_TOKEN_DEL_EQUAL
-      || tokenKind == MP_TOKEN_DEL_MINUS_MORE)
-  {
+  case TokenClass::Number:
+    return NumberColor;
+  case TokenClass::Operator:
     return OperatorColor;
+  case TokenClass::String:
+  case TokenClass::MultilineString:
+    return StringColor;
+  case TokenClass::Comment:
+    return CommentColor;
+  default:
+    assert(tokenClass == TokenClass::Default);
+    return DefaultColor;
   }
-  return DefaultColor;
-}
-
-static inline size_t TokenLength(mp_lexer_t * lex, const char * tokenPosition) {
-  /* The lexer stores the beginning of the current token and of the next token,
-   * so we just use that. */
-  if (lex->line > 1) {
-    /* The next token is on the next line, so we cannot just make the difference
-     * of the columns. */
-    return UTF8Helper::CodePointSearch(tokenPosition, '\n') - tokenPosition;
-  }
-  return lex->column - lex->tok_column;
 }
 
 PythonTextArea::AutocompletionType PythonTextArea::autocompletionType(const char * autocompletionLocation, const char ** autocompletionLocationBeginning, const char ** autocompletionLocationEnd) const {
@@ -170,7 +67,7 @@ PythonTextArea::AutocompletionType PythonTextArea::autocompletionType(const char
 
     while (currentTokenKind != MP_TOKEN_NEWLINE && currentTokenKind != MP_TOKEN_END) {
       tokenStart = firstNonSpace + lex->tok_column - 1;
-      tokenEnd = tokenStart + TokenLength(lex, tokenStart);
+      tokenEnd = tokenStart + PythonHighlighter::TokenLength(lex, tokenStart);
 
       if (location < tokenStart) {
         // The location for autocompletion is not in an identifier
@@ -241,135 +138,76 @@ void PythonTextArea::ContentView::clearRect(KDContext * ctx, KDRect rect) const
 #define LOG_DRAW(...)
 #endif
 
-void PythonTextArea::ContentView::drawLine(KDContext * ctx, int line, const char * text, size_t byteLength, int fromColumn, int toColumn, const char * selectionStart, const char * selectionEnd) const {
-  LOG_DRAW("Drawing \"%.*s\"\n", byteLength, text);
-
-  assert(m_pythonDelegate->isPythonUser(this));
-
-  /* We're using the MicroPython lexer to do syntax highlighting on a per-line
-   * basis. This can work, however the MicroPython lexer won't accept a line
-   * starting with a whitespace. So we're discarding leading whitespaces
-   * beforehand. */
-  const char * firstNonSpace = UTF8Helper::NotCodePointSearch(text, ' ');
-  if (firstNonSpace != text) {
-    // Color the discarded leading whitespaces
-    const char * spacesStart = UTF8Helper::CodePointAtGlyphOffset(text, fromColumn);
-    drawStringAt(
-        ctx,
-        line,
-        fromColumn,
-        spacesStart,
-        std::min(text + byteLength, firstNonSpace) - spacesStart,
-        StringColor,
-        BackgroundColor,
-        selectionStart,
-        selectionEnd,
-        HighlightColor);
+/* PythonTextArea::ContentView::TokenPainter */
+
+class PythonTextArea::ContentView::TokenPainter : public PythonHighlighter::TokenSink {
+public:
+  TokenPainter(const ContentView * view, KDContext * ctx, int line, const char * text, const char * firstVisible, const char * selectionStart, const char * selectionEnd) :
+    m_view(view),
+    m_ctx(ctx),
+    m_line(line),
+    m_text(text),
+    m_previousEnd(firstVisible),
+    m_selectionStart(selectionStart),
+    m_selectionEnd(selectionEnd)
+  {}
+  void addToken(const char * start, const char * end, TokenClass tokenClass) override {
+    fillUntil(start);
+    // If the token is being autocompleted, use DefaultColor
+    const char * autocompleteStart = m_view->m_autocomplete ? m_view->m_cursorLocation : nullptr;
+    bool isAutocompleted = start <= autocompleteStart && autocompleteStart < end && tokenClass != TokenClass::MultilineString && tokenClass != TokenClass::Comment;
+    LOG_DRAW("Draw \"%.*s\" for token class %d\n", static_cast<int>(end - start), start, static_cast<int>(tokenClass));
+    draw(start, end, isAutocompleted ? DefaultColor : TokenClassColor(tokenClass));
+    m_previousEnd = std::max(m_previousEnd, end);
   }
-  if (UTF8Helper::CodePointIs(firstNonSpace, UCodePointNull)) {
-    return;
+  void fillUntil(const char * position) {
+    if (position > m_previousEnd) {
+      // We passed over white spaces, we need to color them
+      draw(m_previousEnd, position, StringColor);
+      m_previousEnd = position;
+    }
   }
-
-  const char * autocompleteStart = m_autocomplete ? m_cursorLocation : nullptr;
-
-  nlr_buf_t nlr;
-  if (nlr_push(&nlr) == 0) {
-    mp_lexer_t * lex = mp_lexer_new_from_str_len(0, firstNonSpace, byteLength - (firstNonSpace - text), 0);
-    LOG_DRAW("Pop token %d\n", lex->tok_kind);
-
-    const char * tokenFrom = firstNonSpace;
-    size_t tokenLength = 0;
-    const char * tokenEnd = firstNonSpace;
-    while (lex->tok_kind != MP_TOKEN_NEWLINE && lex->tok_kind != MP_TOKEN_END) {
-      tokenFrom = firstNonSpace + lex->tok_column - 1;
-      if (tokenFrom != tokenEnd) {
-        // We passed over white spaces, we need to color them
-        drawStringAt(
-            ctx,
-            line,
-            UTF8Helper::GlyphOffsetAtCodePoint(text, tokenEnd),
-            tokenEnd,
-            std::min(text + byteLength, tokenFrom) - tokenEnd,
-            StringColor,
-            BackgroundColor,
-            selectionStart,
-            selectionEnd,
-            HighlightColor);
-      }
-      tokenLength = TokenLength(lex, tokenFrom);
-      tokenEnd = tokenFrom + tokenLength;
-
-      // If the token is being autocompleted, use DefaultColor
-      KDColor color = (tokenFrom <= autocompleteStart && autocompleteStart < tokenEnd) ? DefaultColor : TokenColor(lex->tok_kind);
-
-      if (color != DefaultColor && (lex->tok_kind == MP_TOKEN_INTEGER || lex->tok_kind == MP_TOKEN_FLOAT_OR_IMAG)) {
-        /* Check if the token can actually be parsed because lexer might label
-         * tokens that cannot be parsed as integer or float */
-        nlr_buf_t nlrNumberColorParse;
-        if (nlr_push(&nlrNumberColorParse) == 0) {
-          /* Use ex->vstr.len instead of tokenLength because it translates
-           * escaped chars as the interpreter would do. */
-          if (lex->tok_kind == MP_TOKEN_INTEGER) {
-            mp_parse_num_integer(tokenFrom, lex->vstr.len, 0, NULL);
-          } else {
-            mp_parse_num_decimal(tokenFrom, lex->vstr.len, true, false, NULL);
-          }
-          nlr_pop();
-        } else {
-          // Parsing raised an exception, use DefaultColor.
-          color = DefaultColor;
-        }
-      }
-
-      LOG_DRAW("Draw \"%.*s\" for token %d\n", tokenLength, tokenFrom, lex->tok_kind);
-      drawStringAt(ctx, line,
-        UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
-        tokenFrom,
-        tokenLength,
+private:
+  void draw(const char * start, const char * end, KDColor color) {
+    m_view->drawStringAt(
+        m_ctx,
+        m_line,
+        UTF8Helper::GlyphOffsetAtCodePoint(m_text, start),
+        start,
+        end - start,
         color,
         BackgroundColor,
-        selectionStart,
-        selectionEnd,
+        m_selectionStart,
+        m_selectionEnd,
         HighlightColor);
+  }
+  const ContentView * m_view;
+  KDContext * m_ctx;
+  int m_line;
+  const char * m_text;
+  const char * m_previousEnd;
+  const char * m_selectionStart;
+  const char * m_selectionEnd;
+};
 
-      mp_lexer_to_next(lex);
-      LOG_DRAW("Pop token %d\n", lex->tok_kind);
-    }
+/* PythonTextArea::ContentView */
 
-    tokenFrom += tokenLength;
-
-    // Even if the token is being autocompleted, use CommentColor
-    if (tokenFrom < text + byteLength) {
-      LOG_DRAW("Draw comment \"%.*s\" from %d\n", byteLength - (tokenFrom - text), firstNonSpace, tokenFrom);
-      drawStringAt(ctx, line,
-          UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
-          tokenFrom,
-          text + byteLength - tokenFrom,
-          CommentColor,
-          BackgroundColor,
-          selectionStart,
-          selectionEnd,
-          HighlightColor);
-    }
+void PythonTextArea::ContentView::drawLine(KDContext * ctx, int line, const char * text, size_t byteLength, int fromColumn, int toColumn, const char * selectionStart, const char * selectionEnd) const {
+  LOG_DRAW("Drawing \"%.*s\"\n", byteLength, text);
 
-    mp_lexer_free(lex);
-    nlr_pop();
-  } else { // Uncaught exception
-    MicroPython::ExecutionEnvironment::HandleExceptionSilently();
-    drawStringAt(
-        ctx,
-        line,
-        fromColumn,
-        text,
-        byteLength,
-        DefaultColor,
-        BackgroundColor,
-        selectionStart,
-        selectionEnd,
-        HighlightColor);
-  }
+  assert(m_pythonDelegate->isPythonUser(this));
+
+  /* Leading whitespaces before the first visible column do not need to be
+   * drawn. */
+  const char * firstNonSpace = UTF8Helper::NotCodePointSearch(text, ' ');
+  const char * spacesStart = UTF8Helper::CodePointAtGlyphOffset(text, fromColumn);
+  TokenPainter painter(this, ctx, line, text, std::min(firstNonSpace, spacesStart), selectionStart, selectionEnd);
+
+  m_highlighter.highlightLine(m_text.text(), line, text, byteLength, &painter);
+  painter.fillUntil(text + byteLength);
 
   // Redraw the autocompleted word in the right color
+  const char * autocompleteStart = m_autocomplete ? m_cursorLocation : nullptr;
   if (m_autocomplete && autocompleteStart >= text && autocompleteStart < text + byteLength) {
     assert(m_autocompletionEnd != nullptr && m_autocompletionEnd > autocompleteStart);
     drawStringAt(
@@ -386,6 +224,17 @@ void PythonTextArea::ContentView::drawLine(KDContext * ctx, int line, const char
   }
 }
 
+void PythonTextArea::ContentView::didModifyTextAtLocation(const char * location) {
+  const char * lineStart = location;
+  while (lineStart > text() && *(lineStart - 1) != '\n') {
+    lineStart--;
+  }
+  int line = m_text.positionAtPointer(lineStart).line();
+  if (m_highlighter.didModifyLine(line, lineStart, m_pythonDelegate->isPythonUser(this))) {
+    reloadRectFromPosition(lineStart, true);
+  }
+}
+
 KDRect PythonTextArea::ContentView::dirtyRectFromPosition(const char * position, bool includeFollowingLines) const {
   /* Mark the whole line as dirty.
    * TextArea has a very conservative approach and only dirties the surroundings
@@ -1,6 +1,7 @@
 #ifndef CODE_PYTHON_TEXT_AREA_H
 #define CODE_PYTHON_TEXT_AREA_H
 
+#include "python_highlighter.h"
 #include <escher/text_area.h>
 
 namespace Code {
@@ -57,9 +58,15 @@ protected:
     void drawLine(KDContext * ctx, int line, const char * text, size_t length, int fromColumn, int toColumn, const char * selectionStart, const char * selectionEnd) const override;
     KDRect dirtyRectFromPosition(const char * position, bool includeFollowingLines) const override;
   private:
+    typedef PythonHighlighter::TokenClass TokenClass;
+    class TokenPainter;
+    static KDColor TokenClassColor(TokenClass tokenClass);
+    void didModifyTextAtLocation(const char * location) override;
+
     App * m_pythonDelegate;
     bool m_autocomplete;
     const char * m_autocompletionEnd;
+    PythonHighlighter m_highlighter;
   };
 private:
   void removeAutocompletion();
@@ -0,0 +1,95 @@
+#include <quiz.h>
+#include "../python_highlighter.h"
+#include <python/test/execution_environment.h>
+#include <string.h>
+
+namespace Code {
+
+typedef PythonHighlighter::TokenClass TokenClass;
+
+class TokenRecorder : public PythonHighlighter::TokenSink {
+public:
+  TokenRecorder() : m_numberOfTokens(0) {}
+  void addToken(const char * start, const char * end, TokenClass tokenClass) override {
+    quiz_assert(m_numberOfTokens < k_maxNumberOfTokens);
+    m_tokenClasses[m_numberOfTokens++] = tokenClass;
+  }
+  int numberOfTokens() const { return m_numberOfTokens; }
+  TokenClass tokenClassAtIndex(int i) const { return m_tokenClasses[i]; }
+private:
+  constexpr static int k_maxNumberOfTokens = 16;
+  TokenClass m_tokenClasses[k_maxNumberOfTokens];
+  int m_numberOfTokens;
+};
+
+const char * line_start(const char * text, int line) {
+  const char * lineStart = text;
+  for (int i = 0; i < line; i++) {
+    lineStart = strchr(lineStart, '\n');
+    quiz_assert(lineStart != nullptr);
+    lineStart++;
+  }
+  return lineStart;
+}
+
+void assert_line_is_highlighted_as(const PythonHighlighter * highlighter, const char * text, int line, const TokenClass * tokenClasses, int numberOfTokens) {
+  const char * lineStart = line_start(text, line);
+  const char * lineEnd = strchr(lineStart, '\n');
+  size_t length = lineEnd ? lineEnd - lineStart : strlen(lineStart);
+  TokenRecorder recorder;
+  highlighter->highlightLine(text, line, lineStart, length, &recorder);
+  quiz_assert(recorder.numberOfTokens() == numberOfTokens);
+  for (int i = 0; i < numberOfTokens; i++) {
+    quiz_assert(recorder.tokenClassAtIndex(i) == tokenClasses[i]);
+  }
+}
+
+QUIZ_CASE(code_python_highlighter_multiline_strings) {
+  init_environement();
+  PythonHighlighter highlighter;
+  const char * text = "a = '''x\ny\nz''' + 1\nb";
+  // Lines can be highlighted in any order
+  const TokenClass inString[] = {TokenClass::MultilineString};
+  assert_line_is_highlighted_as(&highlighter, text, 1, inString, 1);
+  const TokenClass opening[] = {TokenClass::Default, TokenClass::Operator, TokenClass::String};
+  assert_line_is_highlighted_as(&highlighter, text, 0, opening, 3);
+  const TokenClass closing[] = {TokenClass::MultilineString, TokenClass::Operator, TokenClass::Number};
+  assert_line_is_highlighted_as(&highlighter, text, 2, closing, 3);
+  const TokenClass code[] = {TokenClass::Default};
+  assert_line_is_highlighted_as(&highlighter, text, 3, code, 1);
+  deinit_environment();
+}
+
+QUIZ_CASE(code_python_highlighter_cache_invalidation) {
+  init_environement();
+  PythonHighlighter highlighter;
+  char text[] = "x = 1\ny = 2\nz = 3";
+  const TokenClass assignNumber[] = {TokenClass::Default, TokenClass::Operator, TokenClass::Number};
+  const TokenClass assignName[] = {TokenClass::Default, TokenClass::Operator, TokenClass::Default};
+  for (int line = 0; line < 3; line++) {
+    assert_line_is_highlighted_as(&highlighter, text, line, assignNumber, 3);
+  }
+
+  // An edit keeping the length of the line is only seen once notified
+  text[4] = 'a';
+  assert_line_is_highlighted_as(&highlighter, text, 0, assignNumber, 3);
+  quiz_assert(!highlighter.didModifyLine(0, text, true));
+  assert_line_is_highlighted_as(&highlighter, text, 0, assignName, 3);
+  assert_line_is_highlighted_as(&highlighter, text, 1, assignNumber, 3);
+
+  // Opening a triple-quoted string changes the following lines
+  memcpy(text + 6, "y=\"\"\"", 5);
+  quiz_assert(highlighter.didModifyLine(1, line_start(text, 1), true));
+  const TokenClass opening[] = {TokenClass::Default, TokenClass::Operator, TokenClass::String};
+  assert_line_is_highlighted_as(&highlighter, text, 1, opening, 3);
+  const TokenClass inString[] = {TokenClass::MultilineString};
+  assert_line_is_highlighted_as(&highlighter, text, 2, inString, 1);
+
+  // Closing it restores them
+  memcpy(text + 6, "y = 2", 5);
+  quiz_assert(highlighter.didModifyLine(1, line_start(text, 1), true));
+  assert_line_is_highlighted_as(&highlighter, text, 2, assignNumber, 3);
+  deinit_environment();
+}
+
+}
@@ -428,6 +428,7 @@ void VariableBoxController::loadBuiltinNodes(const char * textToAutocomplete, in
     {"and", ScriptNode::Type::WithoutParentheses},
     {qstr_str(MP_QSTR_any), ScriptNode::Type::WithParentheses},
     {qstr_str(MP_QSTR_append), ScriptNode::Type::WithParentheses},
+    {qstr_str(MP_QSTR_array), ScriptNode::Type::WithoutParentheses},
     {"as", ScriptNode::Type::WithoutParentheses},
     //{qstr_str(MP_QSTR_ascii), ScriptNode::Type::WithParentheses},
     {"assert", ScriptNode::Type::WithoutParentheses},
@@ -44,7 +44,7 @@ public:
 private:
   constexpr static size_t k_maxNumberOfDisplayedItems = Escher::Metric::MinimalNumberOfScrollableRowsToFillDisplayHeight(Escher::TableCell::k_minimalSmallFontCellHeight, Escher::Metric::PopUpTopMargin);
   constexpr static size_t k_maxNumberOfDisplayedSubtitles = Escher::Metric::MinimalNumberOfScrollableRowsToFillDisplayHeight(SubtitleCell::k_subtitleRowHeight + Escher::TableCell::k_minimalSmallFontCellHeight, Escher::Metric::PopUpTopMargin);
-  constexpr static size_t k_totalBuiltinNodesCount = 107;
+  constexpr static size_t k_totalBuiltinNodesCount = 108;
   constexpr static size_t k_maxOtherScriptNodesCount = 32; // Chosen without particular reasons
   constexpr static size_t k_maxScriptNodesCount = k_maxOtherScriptNodesCount + k_totalBuiltinNodesCount + k_maxOtherScriptNodesCount; // CurrentScriptOrigin + BuiltinsOrigin + ImportedOrigin
   constexpr static uint8_t k_maxOrigins = 10; // currentScriptOrigin + builtinsOrigin + 8 importedOrigins max
@@ -0,0 +1,86 @@
+#include "amortization_controller.h"
+#include "app.h"
+#include <apps/i18n.h>
+#include <apps/shared/poincare_helpers.h>
+#include <escher/palette.h>
+#include <poincare/print.h>
+#include <assert.h>
+
+using namespace Finance;
+
+AmortizationController::AmortizationController(Escher::StackViewController * parentResponder) :
+      Escher::SelectableViewController(parentResponder),
+      m_selectableTableView(this, this, this, this) {
+  m_selectableTableView.setBackgroundColor(Escher::Palette::WallScreenDark);
+  m_selectableTableView.setVerticalCellOverlap(0);
+  m_selectableTableView.setMargins(Escher::Metric::CommonTopMargin, Escher::Metric::CommonRightMargin, Escher::Metric::CommonBottomMargin, Escher::Metric::CommonLeftMargin);
+  constexpr I18n::Message titles[k_numberOfColumns] = {I18n::Message::FinanceLowerN, I18n::Message::FinanceInterest, I18n::Message::FinancePrincipal, I18n::Message::FinanceBalance};
+  for (int i = 0; i < k_numberOfColumns; i++) {
+    m_titleCells[i].setMessageFont(KDFont::Size::Small);
+    m_titleCells[i].setMessage(titles[i]);
+  }
+}
+
+const char * AmortizationController::title() {
+  return I18n::translate(I18n::Message::FinanceAmortizationSchedule);
+}
+
+void AmortizationController::viewWillAppear() {
+  ViewController::viewWillAppear();
+  m_selectableTableView.reloadData(false, false);
+}
+
+void AmortizationController::didBecomeFirstResponder() {
+  // Start on the first period of the schedule
+  m_selectableTableView.selectCellAtLocation(0, 1);
+}
+
+bool AmortizationController::handleEvent(Ion::Events::Event event) {
+  return popFromStackViewControllerOnLeftEvent(event);
+}
+
+void AmortizationController::tableViewDidChangeSelection(Escher::SelectableTableView * t, int previousSelectedCellX, int previousSelectedCellY, bool withinTemporarySelection) {
+  if (withinTemporarySelection) {
+    return;
+  }
+  // The title row can't be selected
+  if (t->selectedRow() == 0) {
+    t->selectCellAtLocation(t->selectedColumn(), 1);
+  }
+}
+
+int AmortizationController::numberOfRows() const {
+  return 1 + App::GetCompoundInterestData()->numberOfAmortizationPeriods();
+}
+
+Escher::HighlightCell * AmortizationController::reusableCell(int index, int type) {
+  if (type == k_titleCellType) {
+    assert(index >= 0 && index < k_numberOfColumns);
+    return &m_titleCells[index];
+  }
+  assert(type == k_valueCellType && index >= 0 && index < reusableCellCount(type));
+  return &m_valueCells[index];
+}
+
+int AmortizationController::reusableCellCount(int type) {
+  return type == k_titleCellType ? k_numberOfColumns : k_maxNumberOfDisplayableRows * k_maxNumberOfDisplayableColumns;
+}
+
+void AmortizationController::willDisplayCellAtLocation(Escher::HighlightCell * cell, int i, int j) {
+  Escher::EvenOddCell * evenOddCell = static_cast<Escher::EvenOddCell *>(cell);
+  evenOddCell->setEven(j%2 == 0);
+  evenOddCell->setHighlighted(i == selectedColumn() && j == selectedRow());
+  if (j == 0) {
+    return;
+  }
+  constexpr int bufferSize = Poincare::PrintFloat::charSizeForFloatsWithPrecision(k_numberOfSignificantDigits);
+  char buffer[bufferSize];
+  if (i == 0) {
+    Poincare::Print::CustomPrintf(buffer, bufferSize, "%i", j);
+  } else {
+    CompoundInterestData::AmortizationRow row = App::GetCompoundInterestData()->amortizationRowAtPeriod(j);
+    double value = i == 1 ? row.interest : (i == 2 ? row.principal : row.balance);
+    Shared::PoincareHelpers::ConvertFloatToTextWithDisplayMode<double>(value, buffer, bufferSize, k_numberOfSignificantDigits, Poincare::Preferences::PrintFloatMode::Decimal);
+  }
+  static_cast<Escher::EvenOddBufferTextCell *>(cell)->setText(buffer);
+}
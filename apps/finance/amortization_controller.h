@@ -0,0 +1,64 @@
+#ifndef FINANCE_AMORTIZATION_CONTROLLER_H
+#define FINANCE_AMORTIZATION_CONTROLLER_H
+
+#include <escher/even_odd_buffer_text_cell.h>
+#include <escher/even_odd_message_text_cell.h>
+#include <escher/metric.h>
+#include <escher/regular_table_view_data_source.h>
+#include <escher/selectable_list_view_controller.h>
+#include <escher/selectable_table_view.h>
+#include <escher/selectable_table_view_delegate.h>
+#include <escher/stack_view_controller.h>
+#include <ion/events.h>
+#include <poincare/preferences.h>
+#include <poincare/print_float.h>
+
+namespace Finance {
+
+/* Table of the interest, principal and balance of each period of the compound
+ * interest data. Rows are computed when they are displayed, so that only the
+ * visible ones are ever evaluated. */
+class AmortizationController : public Escher::SelectableViewController, public Escher::RegularTableViewDataSource, public Escher::SelectableTableViewDelegate {
+public:
+  AmortizationController(Escher::StackViewController * parentResponder);
+
+  // ViewController
+  const char * title() override;
+  ViewController::TitlesDisplay titlesDisplay() override { return ViewController::TitlesDisplay::DisplayLastTitle; }
+  Escher::View * view() override { return &m_selectableTableView; }
+  void viewWillAppear() override;
+  void didBecomeFirstResponder() override;
+  bool handleEvent(Ion::Events::Event event) override;
+
+  // TableViewDataSource
+  int numberOfRows() const override;
+  int numberOfColumns() const override { return k_numberOfColumns; }
+  int typeAtLocation(int i, int j) override { return j == 0 ? k_titleCellType : k_valueCellType; }
+  Escher::HighlightCell * reusableCell(int index, int type) override;
+  int reusableCellCount(int type) override;
+  void willDisplayCellAtLocation(Escher::HighlightCell * cell, int i, int j) override;
+
+  // SelectableTableViewDelegate
+  void tableViewDidChangeSelection(Escher::SelectableTableView * t, int previousSelectedCellX, int previousSelectedCellY, bool withinTemporarySelection) override;
+
+private:
+  constexpr static int k_numberOfColumns = 4; // Period, interest, principal and balance
+  constexpr static int k_titleCellType = 0;
+  constexpr static int k_valueCellType = 1;
+  constexpr static int k_numberOfSignificantDigits = Poincare::Preferences::VeryLargeNumberOfSignificantDigits;
+  constexpr static KDCoordinate k_cellHeight = Escher::Metric::SmallEditableCellHeight;
+  constexpr static KDCoordinate k_cellWidth = Escher::Metric::SmallFontCellWidth(Poincare::PrintFloat::glyphLengthForFloatWithPrecision(k_numberOfSignificantDigits), Escher::EvenOddCell::k_horizontalMargin);
+  constexpr static int k_maxNumberOfDisplayableRows = Escher::Metric::MinimalNumberOfScrollableRowsToFillDisplayHeight(k_cellHeight, Escher::Metric::StackTitleHeight);
+  constexpr static int k_maxNumberOfDisplayableColumns = k_numberOfColumns;
+
+  KDCoordinate defaultRowHeight() override { return k_cellHeight; }
+  KDCoordinate defaultColumnWidth() override { return k_cellWidth; }
+
+  Escher::SelectableTableView m_selectableTableView;
+  Escher::EvenOddMessageTextCell m_titleCells[k_numberOfColumns];
+  Escher::EvenOddBufferTextCell m_valueCells[k_maxNumberOfDisplayableRows * k_maxNumberOfDisplayableColumns];
+};
+
+}  // namespace Finance
+
+#endif /* FINANCE_AMORTIZATION_CONTROLLER_H */
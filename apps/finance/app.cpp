@@ -55,7 +55,8 @@ void App::didExitPage(Escher::ViewController * controller) {
 // App
 App::App(Snapshot * snapshot) :
   Shared::ExpressionFieldDelegateApp(snapshot, &m_stackViewController),
-  m_resultController(&m_stackViewController),
+  m_amortizationController(&m_stackViewController),
+  m_resultController(&m_stackViewController, &m_amortizationController),
   m_interestController(&m_stackViewController, this, &m_resultController),
   m_interestMenuController(&m_stackViewController, &m_interestController),
   m_menuController(&m_stackViewController, &m_interestMenuController),
@@ -5,6 +5,7 @@
 #include <escher/stack_view_controller.h>
 #include "../shared/expression_field_delegate_app.h"
 #include "../shared/shared_app.h"
+#include "amortization_controller.h"
 #include "data.h"
 #include "menu_controller.h"
 #include "interest_controller.h"
@@ -26,9 +27,9 @@ public:
   // Snapshot
   class Snapshot : public Shared::SharedApp::Snapshot {
   public:
-    /* At most 3 nested menus from MenuController :
-     * InterestMenuController, InterestController and ResultController */
-    constexpr static uint8_t k_maxNumberOfStacks = 3;
+    /* At most 4 nested menus from MenuController : InterestMenuController,
+     * InterestController, ResultController and AmortizationController */
+    constexpr static uint8_t k_maxNumberOfStacks = 4;
 
     App * unpack(Escher::Container * container) override;
     const Descriptor * descriptor() const override;
@@ -43,6 +44,7 @@ public:
 
   static App * app() { return static_cast<App *>(Escher::Container::activeApp()); }
   static InterestData * GetInterestData() { return app()->snapshot()->data()->interestData(); }
+  static CompoundInterestData * GetCompoundInterestData() { return app()->snapshot()->data()->compoundInterestData(); }
   static void SetModel(bool selectedModel) { return app()->snapshot()->data()->setModel(selectedModel); }
 
   Snapshot * snapshot() const { return static_cast<Snapshot *>(Escher::App::snapshot()); }
@@ -57,6 +59,7 @@ private:
   App(Snapshot * snapshot);
 
   // Controllers
+  AmortizationController m_amortizationController;
   ResultController m_resultController;
   InterestController m_interestController;
   InterestMenuController m_interestMenuController;
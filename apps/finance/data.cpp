@@ -1,6 +1,8 @@
 #include "data.h"
 #include <poincare/solver.h>
+#include <float.h>
 #include <stdint.h>
+#include <algorithm>
 #include <cmath>
 
 namespace Finance {
@@ -148,7 +150,80 @@ double computeN(double rPct, double PV, double Pmt, double FV, double S, double
          / std::log(1.0 + i);
 }
 
-double computeRPct(double N, double PV, double Pmt, double FV, double PY, double CY, double S) {
+static int NumberOfSignChanges(const double * values, int numberOfValues) {
+  int numberOfSignChanges = 0;
+  double previous = 0.0;
+  for (int k = 0; k < numberOfValues; k++) {
+    if (values[k] == 0.0) {
+      continue;
+    }
+    numberOfSignChanges += (previous * values[k] < 0.0);
+    previous = values[k];
+  }
+  return numberOfSignChanges;
+}
+
+/* Newton's method, safeguarded by a bracket of the root: steps leaving the
+ * bracket are replaced with bisections. The bracket is found by expanding an
+ * interval around the seed, so that a seed close to the root only costs a few
+ * evaluations. Return NAN if f does not change sign in [xMin, xMax]. */
+static double SolveFromSeed(Poincare::Solver<double>::FunctionEvaluation f, const void * aux, double seed, double xMin, double xMax) {
+  double fSeed = f(seed, aux);
+  if (fSeed == 0.0) {
+    return seed;
+  }
+  if (!std::isfinite(fSeed)) {
+    return NAN;
+  }
+  // Expand an interval around the seed until f changes sign on one side
+  double bound = seed, fBound = fSeed;
+  double step = 1e-2 * std::max(1.0, std::fabs(seed));
+  while (!(std::isfinite(fBound) && fBound * fSeed <= 0.0)) {
+    double left = std::max(xMin, seed - step);
+    double right = std::min(xMax, seed + step);
+    bound = right;
+    fBound = f(right, aux);
+    if (!(std::isfinite(fBound) && fBound * fSeed <= 0.0)) {
+      bound = left;
+      fBound = f(left, aux);
+      if (left == xMin && right == xMax && !(std::isfinite(fBound) && fBound * fSeed <= 0.0)) {
+        return NAN;
+      }
+    }
+    step *= 4.0;
+  }
+  if (fBound == 0.0) {
+    return bound;
+  }
+  double lower = std::min(seed, bound);
+  double upper = std::max(seed, bound);
+  bool lowerIsPositive = (seed < bound ? fSeed : fBound) > 0.0;
+  double x = seed;
+  double fx = fSeed;
+  constexpr int k_maxNumberOfIterations = 100;
+  for (int k = 0; k < k_maxNumberOfIterations; k++) {
+    double h = 1e-7 * std::max(1.0, std::fabs(x));
+    double derivative = (f(x + h, aux) - f(x - h, aux)) / (2.0 * h);
+    double next = x - fx / derivative;
+    if (!(next > lower && next < upper)) {
+      next = (lower + upper) / 2.0;
+    }
+    double tolerance = 4.0 * DBL_EPSILON * std::max(1.0, std::fabs(next));
+    if (std::fabs(next - x) <= tolerance || upper - lower <= tolerance) {
+      return next;
+    }
+    x = next;
+    fx = f(x, aux);
+    if (fx == 0.0) {
+      return x;
+    }
+    // Keep the root within the bracket
+    ((fx > 0.0) == lowerIsPositive ? lower : upper) = x;
+  }
+  return x;
+}
+
+double computeRPct(double N, double PV, double Pmt, double FV, double PY, double CY, double S, double seed) {
   if (Pmt == 0.0) {
     // PV + FV*(1 + r/(100*CY))^(-N*CY/PY) = 0
     return 100.0 * CY * (std::pow(-FV / PV, PY / (N * CY)) - 1.0);
@@ -170,7 +245,19 @@ double computeRPct(double N, double PV, double Pmt, double FV, double PY, double
         double a = computeA(i, S, b, N);
         return PV + a * Pmt + b * FV;
       };
-  Poincare::Solver<double> solver(-100., 100.);
+  constexpr double k_minRPct = -100.0;
+  constexpr double k_maxRPct = 100.0;
+  /* With at most one sign change in the cash flows, the root is unique, so that
+   * it can be found from the previous solution, which is often close when a
+   * single parameter was edited. */
+  const double cashFlows[3] = {PV, Pmt, FV};
+  if (std::isfinite(seed) && seed > k_minRPct && seed < k_maxRPct && NumberOfSignChanges(cashFlows, 3) <= 1) {
+    double result = SolveFromSeed(evaluation, parameters, seed, k_minRPct, k_maxRPct);
+    if (!std::isnan(result)) {
+      return result;
+    }
+  }
+  Poincare::Solver<double> solver(k_minRPct, k_maxRPct);
   return solver.nextRoot(evaluation, parameters).x1();
 }
 
@@ -213,7 +300,8 @@ double CompoundInterestData::computeUnknownValue() {
       result = computeN(rPct, PV, Pmt, FV, S, i);
       break;
     case Parameter::rPct:
-      result = computeRPct(N, PV, Pmt, FV, PY, CY, S);
+      // The previous value of the unknown rate seeds the solver
+      result = computeRPct(N, PV, Pmt, FV, PY, CY, S, rPct);
       break;
     case Parameter::PV:
       result = computePV(Pmt, FV, a, b);
@@ -253,6 +341,72 @@ double CompoundInterestData::getValue(uint8_t param) const {
   return m_values[param - k_numberOfSharedDoubleValues];
 }
 
+int CompoundInterestData::numberOfAmortizationPeriods() const {
+  for (uint8_t param = 0; param < k_numberOfDoubleValues; param++) {
+    if (!std::isfinite(getValue(param))) {
+      return 0;
+    }
+  }
+  double N = getValue(static_cast<uint8_t>(Parameter::N));
+  return N < 1.0 ? 0 : static_cast<int>(std::min(std::floor(N), static_cast<double>(k_maxNumberOfAmortizationPeriods)));
+}
+
+CompoundInterestData::AmortizationRow CompoundInterestData::amortizationRowAtPeriod(int period) const {
+  assert(period >= 1);
+  double rPct = getValue(static_cast<uint8_t>(Parameter::rPct));
+  double PV = getValue(static_cast<uint8_t>(Parameter::PV));
+  double Pmt = getValue(static_cast<uint8_t>(Parameter::Pmt));
+  double CY = getValue(static_cast<uint8_t>(Parameter::CY));
+  double PY = getValue(static_cast<uint8_t>(Parameter::PY));
+  double S = (m_booleanParam ? 1.0 : 0.0);
+  double i = computeI(rPct, CY, PY);
+  /* The balance after k periods solves PV + α*Pmt + β*balance = 0 over these
+   * k periods, with a sign flipped as it is still due. */
+  double b = computeB(i, period - 1);
+  double a = computeA(i, S, b, period - 1);
+  double previousBalance = (PV + a * Pmt) / b;
+  AmortizationRow row;
+  row.interest = -i * (previousBalance + S * Pmt);
+  row.principal = Pmt - row.interest;
+  row.balance = previousBalance + row.principal;
+  return row;
+}
+
+double CompoundInterestData::NetPresentValue(double rPct, const double * cashFlows, const int * frequencies, int numberOfCashFlows) {
+  double i = rPct / 100.0;
+  double npv = 0.0;
+  int period = 0;
+  for (int k = 0; k < numberOfCashFlows; k++) {
+    int frequency = frequencies ? frequencies[k] : 1;
+    assert(frequency >= 0);
+    /* A cash flow repeated at the beginning of frequency periods is discounted
+     * as an annuity due. */
+    double b = computeB(i, frequency);
+    npv += cashFlows[k] * computeB(i, period) * computeA(i, 1.0, b, frequency);
+    period += frequency;
+  }
+  return npv;
+}
+
+double CompoundInterestData::InternalRateOfReturn(const double * cashFlows, const int * frequencies, int numberOfCashFlows, double seedRPct) {
+  struct Flows {
+    const double * cashFlows;
+    const int * frequencies;
+    int numberOfCashFlows;
+  };
+  const Flows flows = {cashFlows, frequencies, numberOfCashFlows};
+  Poincare::Solver<double>::FunctionEvaluation evaluation =
+      [](double x, const void * aux) {
+        const Flows * flows = static_cast<const Flows *>(aux);
+        return NetPresentValue(x, flows->cashFlows, flows->frequencies, flows->numberOfCashFlows);
+      };
+  // The rate can't reach -100%, where the cash flows would be infinitely worth
+  constexpr double k_minRPct = -100.0 + 1e-9;
+  constexpr double k_maxRPct = 1e6;
+  double result = SolveFromSeed(evaluation, &flows, seedRPct, k_minRPct, k_maxRPct);
+  return std::isfinite(result) ? result : NAN;
+}
+
 void Data::reset() {
   m_selectedModel = true;
   m_compoundInterestData.resetValues();
@@ -25,6 +25,8 @@ public:
   virtual uint8_t numberOfUnknowns() const = 0;
   virtual I18n::Message dropdownMessageAtIndex(int index) const = 0;
   virtual double computeUnknownValue() = 0;
+  // Number of rows of the amortization schedule, if the model has one
+  virtual int numberOfAmortizationPeriods() const { return 0; }
   virtual void setValue(uint8_t param, double value) {
     assert(param < k_numberOfSharedDoubleValues);
     m_sharedValues[param] = value;
@@ -142,6 +144,31 @@ public:
   void setValue(uint8_t param, double value) override;
   double getValue(uint8_t param) const override;
 
+  /* Schedules are truncated so that a table with one row per period keeps its
+   * height within KDCoordinate range. */
+  constexpr static int k_maxNumberOfAmortizationPeriods = 999;
+  int numberOfAmortizationPeriods() const override;
+
+  struct AmortizationRow {
+    double interest;
+    double principal;
+    double balance;
+  };
+  /* Interest and principal parts of the payment of the given period (starting
+   * at 1), and the balance once it is paid. Each row is computed in constant
+   * time from the closed-form factors, so that a schedule of any length can be
+   * generated lazily, one visible row at a time. */
+  AmortizationRow amortizationRowAtPeriod(int period) const;
+
+  /* Cash flows are received at consecutive periods, starting at period 0.
+   * cashFlows[k] is repeated frequencies[k] times, or once if frequencies is
+   * null. The rate is given in percent per period. */
+  static double NetPresentValue(double rPct, const double * cashFlows, const int * frequencies, int numberOfCashFlows);
+  /* Rate for which the net present value is null. With several sign changes in
+   * the cash flows, there may be several such rates: the one closest to seed
+   * is returned. */
+  static double InternalRateOfReturn(const double * cashFlows, const int * frequencies, int numberOfCashFlows, double seedRPct = 10.0);
+
 private:
   double m_values[k_numberOfDoubleValues - k_numberOfSharedDoubleValues];
 };
@@ -155,6 +182,7 @@ public:
   InterestData * interestData() {
     return m_selectedModel ? static_cast<InterestData *>(&m_simpleInterestData) : static_cast<InterestData *>(&m_compoundInterestData);
   }
+  CompoundInterestData * compoundInterestData() { return &m_compoundInterestData; }
 
 private:
   CompoundInterestData m_compoundInterestData;
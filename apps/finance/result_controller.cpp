@@ -9,41 +9,61 @@
 
 using namespace Finance;
 
-ResultController::ResultController(Escher::StackViewController * parentResponder) :
-      Escher::SelectableCellListPage<Escher::MessageTableCellWithMessageWithBuffer, k_numberOfResultCells, Escher::MemoizedListViewDataSource>(parentResponder),
+ResultController::ResultController(Escher::StackViewController * parentResponder, AmortizationController * amortizationController) :
+      Escher::SelectableListViewController<Escher::MemoizedListViewDataSource>(parentResponder),
+      m_scheduleCell(I18n::Message::FinanceAmortizationSchedule),
       m_messageView(KDFont::Size::Small, I18n::Message::CalculatedValues, KDContext::k_alignCenter, KDContext::k_alignCenter, Escher::Palette::GrayDark, Escher::Palette::WallScreen),
-      m_contentView(&m_selectableTableView, this, &m_messageView) {
+      m_contentView(&m_selectableTableView, this, &m_messageView),
+      m_amortizationController(amortizationController) {
 }
 
 void ResultController::didBecomeFirstResponder() {
   /* Build the result cell here because it only needs to be updated once this
    * controller become first responder. */
-  cellAtIndex(0)->setMessage(App::GetInterestData()->labelForParameter(App::GetInterestData()->getUnknown()));
-  cellAtIndex(0)->setSubLabelMessage(App::GetInterestData()->sublabelForParameter(App::GetInterestData()->getUnknown()));
+  m_resultCell.setMessage(App::GetInterestData()->labelForParameter(App::GetInterestData()->getUnknown()));
+  m_resultCell.setSubLabelMessage(App::GetInterestData()->sublabelForParameter(App::GetInterestData()->getUnknown()));
   double value = App::GetInterestData()->computeUnknownValue();
   constexpr int maxUserPrecision = Poincare::PrintFloat::k_numberOfStoredSignificantDigits;
   constexpr int bufferSize = Poincare::PrintFloat::charSizeForFloatsWithPrecision(maxUserPrecision);
   char buffer[bufferSize];
   int precision = Poincare::Preferences::sharedPreferences()->numberOfSignificantDigits();
   Shared::PoincareHelpers::ConvertFloatToTextWithDisplayMode<double>(value, buffer, bufferSize, precision, Poincare::Preferences::PrintFloatMode::Decimal);
-  cellAtIndex(0)->setAccessoryText(buffer);
+  m_resultCell.setAccessoryText(buffer);
   resetMemoization(true);
-  selectRow(-1);
+  // Only the schedule cell can be entered
+  selectRow(numberOfRows() > 1 ? k_scheduleCellType : -1);
   m_contentView.reload();
 }
 
 bool ResultController::handleEvent(Ion::Events::Event event) {
   if (event == Ion::Events::Copy || event == Ion::Events::Cut) {
-    Escher::Clipboard::SharedClipboard()->store(cellAtIndex(0)->text());
+    Escher::Clipboard::SharedClipboard()->store(m_resultCell.text());
     return true;
   }
   if (event == Ion::Events::Sto || event == Ion::Events::Var) {
-    App::app()->storeValue(cellAtIndex(0)->text());
+    App::app()->storeValue(m_resultCell.text());
+    return true;
+  }
+  if (selectedRow() == k_scheduleCellType && Escher::MessageTableCellWithChevron::ShouldEnterOnEvent(event)) {
+    stackOpenPage(m_amortizationController);
     return true;
   }
   return popFromStackViewControllerOnLeftEvent(event);
 }
 
+int ResultController::numberOfRows() const {
+  return App::GetInterestData()->numberOfAmortizationPeriods() > 0 ? 2 : 1;
+}
+
+Escher::HighlightCell * ResultController::reusableCell(int index, int type) {
+  assert(index == 0);
+  if (type == k_resultCellType) {
+    return &m_resultCell;
+  }
+  assert(type == k_scheduleCellType);
+  return &m_scheduleCell;
+}
+
 const char * ResultController::title() {
   /* Try fitting the known parameters values in the title using a minimal
    * precision. Use "..." at the end if not all parameters fit. */
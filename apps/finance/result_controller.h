@@ -1,6 +1,7 @@
 #ifndef FINANCE_RESULT_CONTROLLER_H
 #define FINANCE_RESULT_CONTROLLER_H
 
+#include <escher/message_table_cell_with_chevron.h>
 #include <escher/message_table_cell_with_message_with_buffer.h>
 #include <escher/message_text_view.h>
 #include <escher/selectable_list_view_controller.h>
@@ -8,14 +9,13 @@
 #include <escher/table_view_with_top_and_bottom_views.h>
 #include <ion/display.h>
 #include <ion/events.h>
+#include "amortization_controller.h"
 
 namespace Finance {
 
-constexpr int k_numberOfResultCells = 1;
-
-class ResultController : public Escher::SelectableCellListPage<Escher::MessageTableCellWithMessageWithBuffer, k_numberOfResultCells, Escher::MemoizedListViewDataSource> {
+class ResultController : public Escher::SelectableListViewController<Escher::MemoizedListViewDataSource> {
 public:
-  ResultController(Escher::StackViewController * parentResponder);
+  ResultController(Escher::StackViewController * parentResponder, AmortizationController * amortizationController);
 
   void didBecomeFirstResponder() override;
   bool handleEvent(Ion::Events::Event e) override;
@@ -23,12 +23,25 @@ public:
   ViewController::TitlesDisplay titlesDisplay() override { return ViewController::TitlesDisplay::DisplayLastAndThirdToLast; }
   Escher::View * view() override { return &m_contentView; }
 
+  // ListViewDataSource
+  // The amortization schedule is only offered when the model has one
+  int numberOfRows() const override;
+  int typeAtIndex(int index) const override { return index; }
+  Escher::HighlightCell * reusableCell(int index, int type) override;
+  int reusableCellCount(int type) override { return 1; }
+
 private:
+  constexpr static int k_resultCellType = 0;
+  constexpr static int k_scheduleCellType = 1;
+
   constexpr static int k_titleBufferSize = 1 + Ion::Display::Width / KDFont::GlyphWidth(KDFont::Size::Small);
   char m_titleBuffer[k_titleBufferSize];
 
+  Escher::MessageTableCellWithMessageWithBuffer m_resultCell;
+  Escher::MessageTableCellWithChevron m_scheduleCell;
   Escher::MessageTextView m_messageView;
   Escher::TableViewWithTopAndBottomViews m_contentView;
+  AmortizationController * m_amortizationController;
 };
 
 }  // namespace Finance
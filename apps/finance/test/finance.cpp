@@ -133,3 +133,67 @@ QUIZ_CASE(finance_compound_interest) {
     assert_interest_solves(values, paymentIsAtBegining, &data);
   }
 }
+
+QUIZ_CASE(finance_compound_interest_rate_from_seed) {
+  double m_sharedValues[InterestData::k_numberOfSharedDoubleValues];
+  CompoundInterestData data(m_sharedValues);
+  const double values[CompoundInterestData::k_numberOfDoubleValues] = {72.0, 12.55741064, 12600.0, 0.0, -250.0, 12.0, 12.0};
+  for (uint8_t paramIndex = 0; paramIndex < data.numberOfDoubleValues(); paramIndex++) {
+    data.setValue(paramIndex, values[paramIndex]);
+  }
+  data.setUnknown(1);
+  // Seeds far from the solution or on the other side of zero still converge
+  const double seeds[] = {12.55741064, 0.0, -99.0, 99.0, NAN};
+  for (double seed : seeds) {
+    data.setValue(1, seed);
+    assert_roughly_equal(data.computeUnknownValue(), values[1], 1e-9, false);
+  }
+}
+
+QUIZ_CASE(finance_amortization_schedule) {
+  double m_sharedValues[InterestData::k_numberOfSharedDoubleValues];
+  CompoundInterestData data(m_sharedValues);
+  const double values[CompoundInterestData::k_numberOfDoubleValues] = {72.0, 12.55741064, 12600.0, 0.0, -250.0, 12.0, 12.0};
+  for (bool paymentIsAtBeginning : {false, true}) {
+    data.m_booleanParam = paymentIsAtBeginning;
+    for (uint8_t paramIndex = 0; paramIndex < data.numberOfDoubleValues(); paramIndex++) {
+      data.setValue(paramIndex, values[paramIndex]);
+    }
+    data.setUnknown(4);
+    double pmt = data.computeUnknownValue();
+    // Rows computed in any order match the balance accumulated period by period
+    double balance = values[2];
+    for (int period = 1; period <= 72; period++) {
+      CompoundInterestData::AmortizationRow row = data.amortizationRowAtPeriod(period);
+      assert_roughly_equal(row.interest + row.principal, pmt, 1e-12, false);
+      balance += row.principal;
+      quiz_assert(std::fabs(row.balance - balance) < 1e-7);
+    }
+    quiz_assert(std::fabs(data.amortizationRowAtPeriod(72).balance) < 1e-7);
+  }
+  data.m_booleanParam = false;
+  data.setValue(4, values[4]);
+  CompoundInterestData::AmortizationRow first = data.amortizationRowAtPeriod(1);
+  assert_roughly_equal(first.interest, -131.8528117, 1e-9, false);
+  assert_roughly_equal(first.principal, -118.1471883, 1e-9, false);
+  assert_roughly_equal(first.balance, 12481.85281, 1e-9, false);
+  // Schedules stop at the last whole period and are truncated when too long
+  quiz_assert(data.numberOfAmortizationPeriods() == 72);
+  data.setValue(0, 72.5);
+  quiz_assert(data.numberOfAmortizationPeriods() == 72);
+  data.setValue(0, 1e6);
+  quiz_assert(data.numberOfAmortizationPeriods() == CompoundInterestData::k_maxNumberOfAmortizationPeriods);
+  data.setValue(1, NAN);
+  quiz_assert(data.numberOfAmortizationPeriods() == 0);
+}
+
+QUIZ_CASE(finance_cash_flows) {
+  const double cashFlows[] = {-1000.0, 300.0, 400.0, 500.0};
+  const int frequencies[] = {1, 1, 2, 1};
+  assert_roughly_equal(CompoundInterestData::NetPresentValue(5.0, cashFlows, frequencies, 4), 405.4123539, 1e-9, false);
+  assert_roughly_equal(CompoundInterestData::InternalRateOfReturn(cashFlows, frequencies, 4), 20.01879105, 1e-9, false);
+  assert_roughly_equal(CompoundInterestData::InternalRateOfReturn(cashFlows, frequencies, 4, -50.0), 20.01879105, 1e-9, false);
+  // Without any sign change, no rate nullifies the net present value
+  const double positiveCashFlows[] = {100.0, 200.0};
+  quiz_assert(std::isnan(CompoundInterestData::InternalRateOfReturn(positiveCashFlows, nullptr, 2)));
+}
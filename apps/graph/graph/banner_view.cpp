@@ -15,7 +15,8 @@ BannerView::BannerView(
   m_derivativeView(k_font, KDContext::k_alignCenter, KDContext::k_alignCenter, TextColor(), BackgroundColor()),
   m_tangentEquationView(k_font, I18n::Message::LinearRegressionFormula, KDContext::k_alignCenter, KDContext::k_alignCenter, TextColor(), BackgroundColor()),
   m_aView(k_font, KDContext::k_alignCenter, KDContext::k_alignCenter, TextColor(), BackgroundColor()),
-  m_bView(k_font, KDContext::k_alignCenter, KDContext::k_alignCenter, TextColor(), BackgroundColor())
+  m_bView(k_font, KDContext::k_alignCenter, KDContext::k_alignCenter, TextColor(), BackgroundColor()),
+  m_parameterView(k_font, KDContext::k_alignCenter, KDContext::k_alignCenter, TextColor(), BackgroundColor())
 {
   for (int i = 0; i < k_maxNumberOfInterests; i++) {
     m_interestMessageView[i] = MessageTextView(k_font, I18n::Message::Default, KDContext::k_alignCenter, KDContext::k_alignCenter, TextColor(), BackgroundColor());
@@ -39,10 +40,11 @@ void BannerView::emptyInterestMessages(Shared::CursorView * cursor) {
 }
 
 
-void BannerView::setDisplayParameters(bool showInterest, bool showDerivative, bool showTangent) {
+void BannerView::setDisplayParameters(bool showInterest, bool showDerivative, bool showTangent, bool showParameter) {
   m_showInterest = showInterest;
   m_showDerivative = showDerivative;
   m_showTangent = showTangent;
+  m_showParameter = showParameter;
 }
 
 View * BannerView::subviewAtIndex(int index) {
@@ -56,8 +58,16 @@ View * BannerView::subviewAtIndex(int index) {
   if (index < Shared::XYBannerView::k_numberOfSubviews) {
     return Shared::XYBannerView::subviewAtIndex(index);
   }
-  View * subviews[] = {&m_derivativeView, &m_tangentEquationView, &m_aView, &m_bView};
-  return subviews[index - Shared::XYBannerView::k_numberOfSubviews];
+  index -= Shared::XYBannerView::k_numberOfSubviews;
+  View * subviews[] = {&m_derivativeView, &m_tangentEquationView, &m_aView, &m_bView, &m_parameterView};
+  bool visible[] = {m_showDerivative, m_showTangent, m_showTangent, m_showTangent, m_showParameter};
+  for (int i = 0; i < static_cast<int>(sizeof(subviews) / sizeof(View *)); i++) {
+    if (visible[i] && index-- == 0) {
+      return subviews[i];
+    }
+  }
+  assert(false);
+  return nullptr;
 }
 
 bool BannerView::lineBreakBeforeSubview(View * subview) const {
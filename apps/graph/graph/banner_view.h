@@ -18,16 +18,17 @@ public:
   Escher::BufferTextView * derivativeView() { return &m_derivativeView; }
   Escher::BufferTextView * aView() { return &m_aView; }
   Escher::BufferTextView * bView() { return &m_bView; }
+  Escher::BufferTextView * parameterView() { return &m_parameterView; }
   int numberOfInterestMessages() const;
   void addInterestMessage(I18n::Message message, Shared::CursorView * cursor);
   void emptyInterestMessages(Shared::CursorView * cursor);
-  void setDisplayParameters(bool showInterest, bool showDerivative, bool showTangent);
+  void setDisplayParameters(bool showInterest, bool showDerivative, bool showTangent, bool showParameter = false);
 
 private:
   constexpr static int k_maxNumberOfInterests = 3;
   int numberOfSubviews() const override {
     // there are 3 views for tangent (aView, bView, tangentEquationView)
-    return XYBannerView::k_numberOfSubviews + numberOfInterestMessages() + m_showDerivative + 3 * m_showTangent;
+    return XYBannerView::k_numberOfSubviews + numberOfInterestMessages() + m_showDerivative + 3 * m_showTangent + m_showParameter;
   };
   Escher::View * subviewAtIndex(int index) override;
   bool lineBreakBeforeSubview(Escher::View * subview) const override;
@@ -41,9 +42,11 @@ private:
   Escher::MessageTextView m_tangentEquationView;
   Escher::BufferTextView m_aView;
   Escher::BufferTextView m_bView;
+  Escher::BufferTextView m_parameterView;
   bool m_showInterest : 1;
   bool m_showDerivative : 1;
   bool m_showTangent : 1;
+  bool m_showParameter : 1;
 };
 
 }
@@ -21,14 +21,17 @@ CurveParameterController::CurveParameterController(Escher::InputEventHandlerDele
   m_graphController(graphController),
   m_graphRange(graphRange),
   m_cursor(cursor),
+  m_parameterName{0},
   m_preimageGraphController(nullptr, graphView, bannerView, graphRange, cursor),
+  m_sweepGraphController(nullptr, graphView, bannerView, graphRange, cursor),
   m_calculationParameterController(this, inputEventHandlerDelegate, graphView, bannerView, graphRange, cursor)
 {
+  m_sweepCell.setMessage(I18n::Message::VaryParameter);
 }
 
 Escher::HighlightCell * CurveParameterController::cell(int index) {
   assert(0 <= index && index < k_numberOfRows);
-  HighlightCell * cells[k_numberOfRows] = {&m_abscissaCell, &m_imageCell, &m_derivativeNumberCell, &m_spacer, &m_calculationCell, &m_optionsCell};
+  HighlightCell * cells[k_numberOfRows] = {&m_abscissaCell, &m_imageCell, &m_derivativeNumberCell, &m_spacer, &m_calculationCell, &m_sweepCell, &m_optionsCell};
   return cells[index];
 }
 
@@ -132,6 +135,12 @@ bool CurveParameterController::handleEvent(Ion::Events::Event event) {
     stack->push(&m_calculationParameterController);
     return true;
   }
+  if (cell == &m_sweepCell && m_sweepCell.ShouldEnterOnEvent(event)) {
+    m_sweepGraphController.setRecord(m_record, m_parameterName);
+    stack->popUntilDepth(InteractiveCurveViewController::k_graphControllerStackDepth, false);
+    stack->push(&m_sweepGraphController);
+    return true;
+  }
   if (cell == &m_optionsCell && m_optionsCell.ShouldEnterOnEvent(event)) {
     Shared::ListParameterController * details = App::app()->listController()->parameterController();
     details->setRecord(m_record); // Will select cell at location (0,0)
@@ -149,6 +158,7 @@ void CurveParameterController::setRecord(Ion::Storage::Record record) {
   Shared::WithRecord::setRecord(record);
   m_derivativeNumberCell.setVisible(shouldDisplayDerivative() || function()->properties().numberOfCurveParameters() == 3);
   m_calculationCell.setVisible(shouldDisplayCalculation());
+  updateSweepCell();
   selectCellAtLocation(0, 0);
   resetMemoization();
   m_preimageGraphController.setRecord(record);
@@ -160,6 +170,8 @@ void CurveParameterController::viewWillAppear() {
    * function changes (in setRecord) and here since show derivative can be
    * toggled from a sub-menu of this one. */
   m_derivativeNumberCell.setVisible(shouldDisplayDerivative() || function()->properties().numberOfCurveParameters() == 3);
+  // The function may have been edited from the options
+  updateSweepCell();
   resetMemoization();
   m_selectableTableView.reloadData();
   SelectableListViewController::viewWillAppear();
@@ -173,4 +185,12 @@ bool CurveParameterController::shouldDisplayDerivative() const {
   return function()->canDisplayDerivative() && m_graphController->displayDerivativeInBanner();
 }
 
+void CurveParameterController::updateSweepCell() {
+  bool hasParameter = ParameterSweep::FindParameter(function().operator->(), App::app()->localContext(), m_parameterName, sizeof(m_parameterName));
+  m_sweepCell.setVisible(hasParameter);
+  if (hasParameter) {
+    m_sweepCell.setSubLabelText(m_parameterName);
+  }
+}
+
 }
@@ -2,11 +2,13 @@
 #define GRAPH_GRAPH_CURVE_PARAMETER_CONTROLLER_H
 
 #include <escher/message_table_cell_with_chevron.h>
+#include <escher/message_table_cell_with_chevron_and_buffer.h>
 #include <escher/buffer_table_cell_with_editable_text.h>
 #include <escher/spacer_cell.h>
 #include "../../shared/explicit_float_parameter_controller.h"
 #include "../../shared/with_record.h"
 #include "calculation_parameter_controller.h"
+#include "sweep_graph_controller.h"
 #include "banner_view.h"
 
 namespace Graph {
@@ -24,7 +26,7 @@ public:
   void viewWillAppear() override;
   TitlesDisplay titlesDisplay() override { return TitlesDisplay::DisplayLastTitle; }
 private:
-  constexpr static int k_numberOfRows = 6;
+  constexpr static int k_numberOfRows = 7;
   float parameterAtIndex(int index) override;
   bool setParameterAtIndex(int parameterIndex, float f) override {
     return confirmParameterAtIndex(parameterIndex, f);
@@ -39,6 +41,7 @@ private:
   bool confirmParameterAtIndex(int parameterIndex, double f);
   bool shouldDisplayCalculation() const;
   bool shouldDisplayDerivative() const;
+  void updateSweepCell();
   bool isDerivative(int index) { return cell(index) == &m_derivativeNumberCell && function()->properties().numberOfCurveParameters() == 2; };
   int cellIndex(int visibleCellIndex) const;
   /* max(Function::k_maxNameWithArgumentSize + CalculateOnFx, CalculateOnTheCurve + max(Color*Curve)) */
@@ -49,11 +52,14 @@ private:
   Escher::BufferTableCellWithEditableText m_derivativeNumberCell;
   Escher::SpacerCell m_spacer;
   Escher::MessageTableCellWithChevron m_calculationCell;
+  Escher::MessageTableCellWithChevronAndBuffer m_sweepCell;
   Escher::MessageTableCellWithChevron m_optionsCell;
   GraphController * m_graphController;
   Shared::InteractiveCurveViewRange * m_graphRange;
   Shared::CurveViewCursor * m_cursor;
+  char m_parameterName[Poincare::SymbolAbstract::k_maxNameSize];
   PreimageGraphController m_preimageGraphController;
+  SweepGraphController m_sweepGraphController;
   CalculationParameterController m_calculationParameterController;
 };
 
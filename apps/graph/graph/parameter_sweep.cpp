@@ -0,0 +1,160 @@
+#include "parameter_sweep.h"
+#include <apps/shared/poincare_helpers.h>
+#include <poincare/decimal.h>
+#include <poincare/ieee754.h>
+#include <poincare/symbol.h>
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+constexpr static int k_maxFunctionDepth = 8;
+
+static bool IsRealScalarSymbol(const Symbol & symbol, Context * context) {
+  const char * name = symbol.name();
+  if (context->expressionTypeForIdentifier(name, strlen(name)) != Context::SymbolAbstractType::Symbol) {
+    return false;
+  }
+  return std::isfinite(PoincareHelpers::ApproximateToScalar<double>(symbol, context));
+}
+
+typedef bool (*SymbolTest)(const Symbol & symbol, Context * context, void * auxiliary);
+
+/* Expanding a function with the context also replaces the symbols it contains,
+ * so the definitions of the functions are walked through here instead. */
+static bool SymbolMatches(const Expression e, SymbolTest test, Context * context, void * auxiliary, int depth = 0) {
+  if (e.type() == ExpressionNode::Type::Symbol) {
+    return test(static_cast<const Symbol &>(e), context, auxiliary);
+  }
+  if (e.type() == ExpressionNode::Type::Function && depth < k_maxFunctionDepth) {
+    // Circular definitions are cut by the depth limit
+    Expression definition = context->expressionForSymbolAbstract(static_cast<const SymbolAbstract &>(e), true);
+    if (!definition.isUninitialized() && SymbolMatches(definition, test, context, auxiliary, depth + 1)) {
+      return true;
+    }
+  }
+  const int numberOfChildren = e.numberOfChildren();
+  for (int i = 0; i < numberOfChildren; i++) {
+    if (SymbolMatches(e.childAtIndex(i), test, context, auxiliary, depth)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ParameterSweep::FindParameter(const ContinuousFunction * function, Context * context, char * name, size_t nameSize) {
+  struct Result {
+    char * name;
+    size_t nameSize;
+  };
+  Result result = {name, nameSize};
+  SymbolTest isParameter = [](const Symbol & symbol, Context * context, void * auxiliary) {
+    if (!IsRealScalarSymbol(symbol, context)) {
+      return false;
+    }
+    Result * result = static_cast<Result *>(auxiliary);
+    strlcpy(result->name, symbol.name(), result->nameSize);
+    return true;
+  };
+  return SymbolMatches(function->expressionClone(), isParameter, context, &result);
+}
+
+bool ParameterSweep::FunctionDependsOnSymbol(const ContinuousFunction * function, const char * name, Context * context) {
+  SymbolTest isSymbol = [](const Symbol & symbol, Context * context, void * auxiliary) {
+    return strcmp(symbol.name(), static_cast<const char *>(auxiliary)) == 0;
+  };
+  return SymbolMatches(function->expressionClone(), isSymbol, context, const_cast<char *>(name));
+}
+
+void ParameterSweep::init(const char * name, Context * context) {
+  strlcpy(m_name, name, sizeof(m_name));
+  Expression definition = context->expressionForSymbolAbstract(Symbol::Builder(m_name, strlen(m_name)), true);
+  assert(!definition.isUninitialized());
+  int length = definition.serialize(m_initialDefinition, k_maxDefinitionSize);
+  if (length >= static_cast<int>(k_maxDefinitionSize) - 1) {
+    m_initialDefinition[0] = 0;
+  }
+  double initialValue = PoincareHelpers::ApproximateToScalar<double>(definition, context);
+  assert(std::isfinite(initialValue));
+  m_initialValue = initialValue;
+  m_stepExponent = initialValue == 0.0 ? -1 : IEEE754<double>::exponentBase10(initialValue) - 1;
+  m_initialGridIndex = std::round(m_stepExponent >= 0 ? initialValue / IEEE754<double>::powerOfTen(m_stepExponent) : initialValue * IEEE754<double>::powerOfTen(-m_stepExponent));
+  m_index = 0;
+  m_valueWasStored = false;
+#if GRAPH_SWEEP_CACHE_SIZE
+  m_numberOfCachedValues = 0;
+  m_nextCachedValues = 0;
+#endif
+}
+
+bool ParameterSweep::step(int numberOfSteps) {
+  int index = std::clamp(m_index + numberOfSteps, -k_maxNumberOfSteps, k_maxNumberOfSteps);
+  if (index == m_index) {
+    return false;
+  }
+  m_index = index;
+  return true;
+}
+
+void ParameterSweep::storeValue(Context * context) {
+  context->setExpressionForSymbolAbstract(Decimal::Builder<double>(value()), Symbol::Builder(m_name, strlen(m_name)));
+  m_valueWasStored = true;
+}
+
+void ParameterSweep::restoreInitialValue(Context * context) const {
+  Expression definition = m_initialDefinition[0] == 0 ? Expression() : Expression::Parse(m_initialDefinition, context);
+  if (definition.isUninitialized()) {
+    definition = Decimal::Builder<double>(m_initialValue);
+  }
+  context->setExpressionForSymbolAbstract(definition, Symbol::Builder(m_name, strlen(m_name)));
+}
+
+double ParameterSweep::valueAtIndex(int index) const {
+  if (index == 0) {
+    return m_initialValue;
+  }
+  /* Values on the grid are computed from an integer, so that they are as close
+   * as possible to the decimal values that are displayed. */
+  double gridIndex = m_initialGridIndex + index;
+  return m_stepExponent >= 0 ? gridIndex * IEEE754<double>::powerOfTen(m_stepExponent) : gridIndex / IEEE754<double>::powerOfTen(-m_stepExponent);
+}
+
+#if GRAPH_SWEEP_CACHE_SIZE
+
+void ParameterSweep::saveCache(int cacheIndex, const ContinuousFunctionCache * cache) {
+  CachedValues * cachedValues = nullptr;
+  for (int i = 0; i < m_numberOfCachedValues; i++) {
+    if (m_cachedValues[i].index == m_index && m_cachedValues[i].cacheIndex == cacheIndex) {
+      cachedValues = m_cachedValues + i;
+      break;
+    }
+  }
+  if (!cachedValues) {
+    // Replace the oldest values
+    cachedValues = m_cachedValues + m_nextCachedValues;
+    m_nextCachedValues = (m_nextCachedValues + 1) % GRAPH_SWEEP_CACHE_SIZE;
+    m_numberOfCachedValues = std::min(m_numberOfCachedValues + 1, GRAPH_SWEEP_CACHE_SIZE);
+  }
+  cachedValues->index = m_index;
+  cachedValues->cacheIndex = cacheIndex;
+  cachedValues->cache = *cache;
+}
+
+bool ParameterSweep::restoreCache(int cacheIndex, ContinuousFunctionCache * cache) const {
+  for (int i = 0; i < m_numberOfCachedValues; i++) {
+    if (m_cachedValues[i].index == m_index && m_cachedValues[i].cacheIndex == cacheIndex) {
+      *cache = m_cachedValues[i].cache;
+      return true;
+    }
+  }
+  return false;
+}
+
+#endif
+
+}
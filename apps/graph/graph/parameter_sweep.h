@@ -0,0 +1,77 @@
+#ifndef GRAPH_PARAMETER_SWEEP_H
+#define GRAPH_PARAMETER_SWEEP_H
+
+#include <apps/constant.h>
+#include <apps/shared/continuous_function.h>
+#include <poincare/context.h>
+#include <poincare/symbol_abstract.h>
+
+namespace Graph {
+
+/* ParameterSweep varies a stored real scalar, such as a in f(x)=a*sin(x), on a
+ * grid of values around its initial value. The grid step is a power of ten one
+ * order of magnitude below the initial value.
+ * With GRAPH_SWEEP_CACHE_SIZE, the values of the curves that depend on the
+ * parameter are kept for the last swept values, so that scrubbing back and
+ * forth does not evaluate them again. */
+
+class ParameterSweep {
+public:
+  constexpr static int k_maxNumberOfSteps = 100;
+
+  /* Find the first stored real scalar the function depends on, either
+   * directly or through the functions it calls. */
+  static bool FindParameter(const Shared::ContinuousFunction * function, Poincare::Context * context, char * name, size_t nameSize);
+  static bool FunctionDependsOnSymbol(const Shared::ContinuousFunction * function, const char * name, Poincare::Context * context);
+
+  ParameterSweep() : m_name{0}, m_initialDefinition{0}, m_initialValue(0.0), m_stepExponent(-1), m_initialGridIndex(0), m_index(0), m_valueWasStored(false) {}
+
+  /* Start a new sweep from the value stored in the context, discarding the
+   * values cached by the previous one. */
+  void init(const char * name, Poincare::Context * context);
+  const char * name() const { return m_name; }
+  double initialValue() const { return m_initialValue; }
+  double value() const { return valueAtIndex(m_index); }
+  int index() const { return m_index; }
+  // Return false if the sweep reached the end of its range
+  bool step(int numberOfSteps);
+  void storeValue(Poincare::Context * context);
+  // True if a swept value replaced the initial definition since init
+  bool valueWasStored() const { return m_valueWasStored; }
+  // Store back the initial definition of the parameter, which may be exact
+  void restoreInitialValue(Poincare::Context * context) const;
+
+#if GRAPH_SWEEP_CACHE_SIZE
+  // Cache of the function at the given cache index for the current value
+  void saveCache(int cacheIndex, const Shared::ContinuousFunctionCache * cache);
+  bool restoreCache(int cacheIndex, Shared::ContinuousFunctionCache * cache) const;
+#endif
+
+private:
+  // Any definition typed by the user fits
+  constexpr static size_t k_maxDefinitionSize = Constant::MaxSerializedExpressionSize;
+  double valueAtIndex(int index) const;
+
+  char m_name[Poincare::SymbolAbstract::k_maxNameSize];
+  // Empty if the definition is too long to be kept
+  char m_initialDefinition[k_maxDefinitionSize];
+  double m_initialValue;
+  int m_stepExponent;
+  int m_initialGridIndex;
+  int m_index;
+  bool m_valueWasStored;
+#if GRAPH_SWEEP_CACHE_SIZE
+  struct CachedValues {
+    int index;
+    int cacheIndex;
+    Shared::ContinuousFunctionCache cache;
+  };
+  CachedValues m_cachedValues[GRAPH_SWEEP_CACHE_SIZE];
+  int m_numberOfCachedValues;
+  int m_nextCachedValues;
+#endif
+};
+
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include <poincare/circuit_breaker_checkpoint.h>
 #include <poincare/exception_checkpoint.h>
 #include <apps/shared/poincare_helpers.h>
+#include <apps/apps_container_helper.h>
 #include <algorithm>
 
 using namespace Poincare;
@@ -12,6 +13,24 @@ namespace Graph {
 
 // PointsOfInterestCache
 
+static uint32_t FunctionsChecksum() {
+  /* The points depend on the function and on what it uses, and on the other
+   * functions through intersections, but not on the rest of the storage.
+   * Metadata such as the domain is written in place without notifying the
+   * storage, so the functions data is hashed along with the versions of their
+   * dependencies. */
+  SymbolDependencyGraph * dependencyGraph = AppsContainerHelper::sharedAppsContainerGlobalContext()->dependencyGraph();
+  ContinuousFunctionStore * store = App::app()->functionStore();
+  uint32_t checksum = 0;
+  int n = store->numberOfModels();
+  for (int i = 0; i < n; i++) {
+    Ion::Storage::Record record = store->recordAtIndex(i);
+    uint32_t words[] = {checksum, dependencyGraph->versionOfRecord(record), record.checksum()};
+    checksum = Ion::crc32Word(words, sizeof(words) / sizeof(uint32_t));
+  }
+  return checksum;
+}
+
 PointsOfInterestCache PointsOfInterestCache::clone() const {
   PointsOfInterestCache result = *this;
   Expression cloneList = result.list().clone();
@@ -22,9 +41,9 @@ PointsOfInterestCache PointsOfInterestCache::clone() const {
 void PointsOfInterestCache::setBounds(float start, float end) {
   assert(start <= end);
 
-  uint32_t checksum = Ion::Storage::FileSystem::sharedFileSystem()->checksum();
+  uint32_t checksum = FunctionsChecksum();
   if (m_checksum != checksum) {
-    /* Discard the old results if anything in the storage has changed. */
+    /* Discard the old results if anything the functions depend on has changed. */
     m_computedStart = m_computedEnd = start;
     m_list.init();
     m_interestingPointsOverflowPool = false;
@@ -168,7 +187,6 @@ bool PointsOfInterestCache::computeNextStep(bool allowUserInterruptions) {
 
 void PointsOfInterestCache::computeBetween(float start, float end) {
   assert(!m_record.isNull());
-  assert(m_checksum == Ion::Storage::FileSystem::sharedFileSystem()->checksum());
   assert(!m_list.isUninitialized());
   assert((end == m_computedStart && start < m_computedStart) || (start == m_computedEnd && end > m_computedEnd));
   assert(start >= m_start && end <= m_end);
@@ -0,0 +1,107 @@
+#include "sweep_graph_controller.h"
+#include "../app.h"
+#include <apps/apps_container_helper.h>
+#include <poincare/preferences.h>
+#include <poincare/print.h>
+#include <algorithm>
+
+using namespace Shared;
+using namespace Poincare;
+using namespace Escher;
+
+namespace Graph {
+
+SweepGraphController::SweepGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, CurveViewCursor * cursor) :
+  SimpleInteractiveCurveViewController(parentResponder, cursor),
+  m_graphView(graphView),
+  m_bannerView(bannerView),
+  m_graphRange(curveViewRange)
+{
+}
+
+const char * SweepGraphController::title() {
+  Poincare::Print::CustomPrintf(m_title, k_titleSize, I18n::translate(I18n::Message::VaryParameterWithName), m_sweep.name());
+  return m_title;
+}
+
+void SweepGraphController::viewWillAppear() {
+  Shared::SimpleInteractiveCurveViewController::viewWillAppear();
+#if GRAPH_SWEEP_CACHE_SIZE
+  ContinuousFunctionStore * store = App::app()->functionStore();
+  int numberOfCachedFunctions = std::min(store->numberOfActiveFunctions(), k_numberOfCachedFunctions);
+  for (int i = 0; i < numberOfCachedFunctions; i++) {
+    m_functionDependsOnParameter[i] = ParameterSweep::FunctionDependsOnSymbol(store->modelForRecord(store->activeRecordAtIndex(i)).operator->(), m_sweep.name(), App::app()->localContext());
+  }
+#endif
+  m_graphView->setFocus(true);
+  m_bannerView->setDisplayParameters(false, false, false, true);
+  reloadBannerView();
+  m_graphView->reload();
+}
+
+bool SweepGraphController::handleEvent(Ion::Events::Event event) {
+  if (event == Ion::Events::Back && m_sweep.valueWasStored()) {
+    /* Cancel the sweep, even if it came back to the initial value which was
+     * stored as a decimal. The stack view controller pops this controller. */
+    m_sweep.restoreInitialValue(AppsContainerHelper::sharedAppsContainerGlobalContext());
+    return false;
+  }
+  return SimpleInteractiveCurveViewController::handleEvent(event);
+}
+
+void SweepGraphController::setRecord(Ion::Storage::Record record, const char * parameterName) {
+  m_graphView->selectRecord(record);
+  m_record = record;
+  m_sweep.init(parameterName, App::app()->localContext());
+}
+
+void SweepGraphController::reloadBannerView() {
+  if (m_record.isNull()) {
+    return;
+  }
+  FunctionBannerDelegate::reloadBannerViewForCursorOnFunction(m_cursor, m_record, Shared::FunctionApp::app()->functionStore(), AppsContainerHelper::sharedAppsContainerGlobalContext());
+  constexpr size_t bufferSize = FunctionBannerDelegate::k_textBufferSize;
+  char buffer[bufferSize];
+  Poincare::Print::CustomPrintf(buffer, bufferSize, "%s=%*.*ed", m_sweep.name(), m_sweep.value(), Poincare::Preferences::sharedPreferences()->displayMode(), numberOfSignificantDigits());
+  m_bannerView->parameterView()->setText(buffer);
+  m_bannerView->reload();
+}
+
+bool SweepGraphController::handleLeftRightEvent(Ion::Events::Event event) {
+  ContinuousFunctionStore * store = App::app()->functionStore();
+#if GRAPH_SWEEP_CACHE_SIZE
+  int numberOfCachedFunctions = std::min(store->numberOfActiveFunctions(), k_numberOfCachedFunctions);
+  for (int i = 0; i < numberOfCachedFunctions; i++) {
+    if (m_functionDependsOnParameter[i]) {
+      m_sweep.saveCache(i, store->cacheAtIndex(i));
+    }
+  }
+#endif
+  int direction = event == Ion::Events::Left ? -1 : 1;
+  if (!m_sweep.step(direction * Ion::Events::longPressFactor())) {
+    return false;
+  }
+  /* Storing the value only resets the models of the functions depending on
+   * the parameter, the others keep their caches. */
+  m_sweep.storeValue(AppsContainerHelper::sharedAppsContainerGlobalContext());
+#if GRAPH_SWEEP_CACHE_SIZE
+  for (int i = 0; i < numberOfCachedFunctions; i++) {
+    ContinuousFunctionCache * cache = store->cacheAtIndex(i);
+    if (m_functionDependsOnParameter[i] && m_sweep.restoreCache(i, cache)) {
+      // Attaching the cache prevents it from being cleared when drawn
+      store->modelForRecord(store->activeRecordAtIndex(i))->setCache(cache);
+    }
+  }
+#endif
+
+  // Keep the cursor on the selected curve
+  Context * context = App::app()->localContext();
+  Coordinate2D<double> xy = store->modelForRecord(m_record)->evaluateXYAtParameter(m_cursor->t(), context);
+  m_cursor->moveTo(m_cursor->t(), xy.x1(), xy.x2());
+  reloadBannerView();
+  interactiveCurveViewRange()->panToMakePointVisible(m_cursor->x(), m_cursor->y(), cursorTopMarginRatio(), cursorRightMarginRatio(), cursorBottomMarginRatio(), cursorLeftMarginRatio(), curveView()->pixelWidth());
+  m_graphView->reload(true, true);
+  return true;
+}
+
+}
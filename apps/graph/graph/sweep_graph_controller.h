@@ -0,0 +1,53 @@
+#ifndef GRAPH_SWEEP_GRAPH_CONTROLLER_H
+#define GRAPH_SWEEP_GRAPH_CONTROLLER_H
+
+#include "graph_view.h"
+#include "banner_view.h"
+#include "graph_controller_helper.h"
+#include "parameter_sweep.h"
+#include "../../shared/simple_interactive_curve_view_controller.h"
+#include "../../shared/function_banner_delegate.h"
+
+namespace Graph {
+
+/* SweepGraphController varies a parameter of the selected curve with the left
+ * and right arrows. OK keeps the last value, Back restores the initial one.
+ * Only the curves depending on the parameter are evaluated again, and the
+ * points of interest are computed once the sweep is over. */
+
+class SweepGraphController : public Shared::SimpleInteractiveCurveViewController, public Shared::FunctionBannerDelegate, public GraphControllerHelper {
+public:
+  SweepGraphController(Escher::Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor);
+  const char * title() override;
+  void viewWillAppear() override;
+  bool handleEvent(Ion::Events::Event event) override;
+  TELEMETRY_ID("Sweep");
+  void setRecord(Ion::Storage::Record record, const char * parameterName);
+private:
+  constexpr static int k_numberOfCachedFunctions = Shared::ContinuousFunctionCache::k_numberOfAvailableCaches;
+
+  float cursorBottomMarginRatio() const override { return cursorBottomMarginRatioForBannerHeight(m_bannerView->minimalSizeForOptimalDisplay().height()); }
+  Shared::InteractiveCurveViewRange * interactiveCurveViewRange() override { return m_graphRange; }
+  Shared::AbstractPlotView * curveView() override { return m_graphView; }
+  BannerView * bannerView() override { return m_bannerView; };
+  GraphView * graphView() override { return m_graphView; };
+  Shared::FunctionBannerDelegate * functionBannerDelegate() override { return this; }
+  void reloadBannerView() override;
+  bool handleLeftRightEvent(Ion::Events::Event event) override;
+
+  // max(VaryParameterWithName) + Poincare::SymbolAbstract::k_maxNameSize
+  constexpr static size_t k_titleSize = 32;
+  char m_title[k_titleSize];
+  GraphView * m_graphView;
+  BannerView * m_bannerView;
+  Shared::InteractiveCurveViewRange * m_graphRange;
+  Ion::Storage::Record m_record;
+  ParameterSweep m_sweep;
+#if GRAPH_SWEEP_CACHE_SIZE
+  bool m_functionDependsOnParameter[k_numberOfCachedFunctions];
+#endif
+};
+
+}
+
+#endif
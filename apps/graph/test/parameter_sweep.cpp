@@ -0,0 +1,69 @@
+#include <quiz.h>
+#include "helper.h"
+#include "../graph/parameter_sweep.h"
+#include <apps/shared/global_context.h>
+#include <apps/shared/poincare_helpers.h>
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
+#include <cmath>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+void assert_sweep_value_is(const ParameterSweep * sweep, double value) {
+  quiz_assert(std::fabs(sweep->value() - value) < 1e-12 * std::fabs(value));
+}
+
+QUIZ_CASE(graph_parameter_sweep) {
+  GlobalContext context;
+  ContinuousFunctionStore store;
+  Symbol a = Symbol::Builder("a", 1);
+  context.setExpressionForSymbolAbstract(Rational::Builder(1, 3), a);
+
+  ContinuousFunction * f = addFunction("f(x)=a*x", &store, &context);
+  char name[SymbolAbstract::k_maxNameSize];
+  quiz_assert(ParameterSweep::FindParameter(f, &context, name, sizeof(name)));
+  quiz_assert(strcmp(name, "a") == 0);
+  quiz_assert(ParameterSweep::FunctionDependsOnSymbol(f, "a", &context));
+  ContinuousFunction * g = addFunction("g(x)=f(x)+1", &store, &context);
+  quiz_assert(ParameterSweep::FunctionDependsOnSymbol(g, "a", &context));
+  ContinuousFunction * h = addFunction("h(x)=x^2", &store, &context);
+  quiz_assert(!ParameterSweep::FindParameter(h, &context, name, sizeof(name)));
+  quiz_assert(!ParameterSweep::FunctionDependsOnSymbol(h, "a", &context));
+
+  ParameterSweep sweep;
+  sweep.init("a", &context);
+  quiz_assert(!sweep.valueWasStored());
+  assert_sweep_value_is(&sweep, 1.0 / 3.0);
+  quiz_assert(sweep.step(1));
+  assert_sweep_value_is(&sweep, 0.34);
+  quiz_assert(sweep.step(-3));
+  assert_sweep_value_is(&sweep, 0.31);
+  sweep.storeValue(&context);
+  quiz_assert(sweep.valueWasStored());
+  quiz_assert(std::fabs(PoincareHelpers::ApproximateToScalar<double>(a, &context) - 0.31) < 1e-12);
+  quiz_assert(sweep.step(-2 * ParameterSweep::k_maxNumberOfSteps));
+  quiz_assert(sweep.index() == -ParameterSweep::k_maxNumberOfSteps);
+  quiz_assert(!sweep.step(-1));
+
+  // The initial exact definition is stored back
+  sweep.restoreInitialValue(&context);
+  quiz_assert(context.expressionForSymbolAbstract(a, false).isIdenticalTo(Rational::Builder(1, 3)));
+
+  // Long definitions are stored back too
+  Expression longDefinition = Expression::Parse("√(2)+√(3)+√(5)+√(6)+√(7)+√(10)+√(11)", &context);
+  context.setExpressionForSymbolAbstract(longDefinition, a);
+  Expression storedDefinition = context.expressionForSymbolAbstract(a, false);
+  sweep.init("a", &context);
+  quiz_assert(sweep.step(1));
+  sweep.storeValue(&context);
+  sweep.restoreInitialValue(&context);
+  quiz_assert(context.expressionForSymbolAbstract(a, false).isIdenticalTo(storedDefinition));
+
+  store.removeAll();
+  Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtension("a", Ion::Storage::expExtension).destroy();
+}
+
+}
@@ -3,6 +3,7 @@
 #include <escher/clipboard.h>
 #include <poincare/circuit_breaker_checkpoint.h>
 #include <poincare/decimal.h>
+#include <poincare/exception_checkpoint.h>
 #include <poincare/layout_helper.h>
 #include <poincare/matrix_layout.h>
 #include <poincare/serialization_helper.h>
@@ -46,8 +47,12 @@ ValuesController::ValuesController(Responder * parentResponder, Escher::InputEve
   }, this), &m_exactValuesDotView, k_cellFont),
   m_widthManager(this),
   m_heightManager(this),
-  m_exactValuesAreActivated(false)
+  m_exactValuesAreActivated(false),
+  m_nextCachedExactLayoutIndex(0)
 {
+  for (int i = 0; i < k_maxNumberOfMemoizedCells; i++) {
+    m_exactLayoutIsPending[i] = false;
+  }
   m_prefacedTwiceTableView.setPrefaceDelegate(this);
   initValueCells();
   m_exactValuesButton.setState(m_exactValuesAreActivated);
@@ -56,7 +61,17 @@ ValuesController::ValuesController(Responder * parentResponder, Escher::InputEve
 
 bool ValuesController::displayButtonExactValues() const {
   // Above this value, the performances significantly drop.
-  return numberOfValuesColumns() <= ContinuousFunctionStore::k_maxNumberOfMemoizedModels;
+  if (numberOfValuesColumns() > ContinuousFunctionStore::k_maxNumberOfMemoizedModels) {
+    return false;
+  }
+  /* Exact values are measured on every row and can be much taller than
+   * approximations, so they are not displayed in long tables. */
+  for (size_t symbolTypeIndex = 0; symbolTypeIndex < k_maxNumberOfSymbolTypes; symbolTypeIndex++) {
+    if (m_numberOfValuesColumnsForType[symbolTypeIndex] > 0 && App::app()->intervalForSymbolType(static_cast<ContinuousFunctionProperties::SymbolType>(symbolTypeIndex))->numberOfElements() > Interval::k_maxNumberOfEditableElements) {
+      return false;
+    }
+  }
+  return true;
 }
 
 // ViewController
@@ -66,6 +81,17 @@ void ValuesController::viewDidDisappear() {
   Shared::ValuesController::viewDidDisappear();
 }
 
+// Responder
+
+bool ValuesController::handleEvent(Ion::Events::Event event) {
+  if (event == Ion::Events::Idle && m_exactValuesAreActivated && Container::activeApp()->firstResponder() == selectableTableView()) {
+    // Compute the exact values when the user is not active
+    computePendingExactLayouts();
+    return true;
+  }
+  return Shared::ValuesController::handleEvent(event);
+}
+
 // TableViewDataSource
 
 void ValuesController::willDisplayCellAtLocation(HighlightCell * cell, int i, int j) {
@@ -167,8 +193,11 @@ KDCoordinate ValuesController::nonMemoizedColumnWidth(int i) {
   int nRows = numberOfElementsInColumn(i) + 1;
   for (int j = 0; j < nRows; j++) {
     if (typeAtLocation(i, j) == k_notEditableValueCellType) {
-      Layout l = memoizedLayoutForCell(i, j);
-      assert(!l.isUninitialized());
+      // Cells that are not computed yet display approximations
+      Layout l = knownLayoutForCell(i, j);
+      if (l.isUninitialized()) {
+        continue;
+      }
       columnWidth = std::max(CellSizeWithLayout(l).width(), columnWidth);
       if (columnWidth > maxColumnWidth) {
         return maxColumnWidth;
@@ -208,8 +237,10 @@ KDCoordinate ValuesController::nonMemoizedRowHeight(int j) {
     }
     if (typeAtLocation(i, j) == k_notEditableValueCellType && j < numberOfElementsInColumn(i) + 1) {
       assert(m_exactValuesAreActivated);
-      Layout l = memoizedLayoutForCell(i, j);
-      assert(!l.isUninitialized());
+      Layout l = knownLayoutForCell(i, j);
+      if (l.isUninitialized()) {
+        continue;
+      }
       rowHeight = std::max(CellSizeWithLayout(l).height(), rowHeight);
       if (rowHeight > maxRowHeight) {
         return maxRowHeight;
@@ -279,7 +310,7 @@ void ValuesController::updateNumberOfColumns() const {
 }
 
 Poincare::Layout * ValuesController::memoizedLayoutAtIndex(int i) {
-  assert(i >= 0 && i < k_maxNumberOfDisplayableCells);
+  assert(i >= 0 && i < k_maxNumberOfMemoizedCells);
   return &m_memoizedLayouts[i];
 }
 
@@ -325,31 +356,26 @@ void ValuesController::createMemoizedLayout(int column, int row, int index) {
   bool isDerivative = false;
   Shared::ExpiringPointer<ContinuousFunction> function = functionAtIndex(column, row, &abscissa, &isDerivative);
   Poincare::Context * context = textFieldDelegateApp()->localContext();
+  m_exactLayoutIsPending[index] = false;
   Expression result;
   if (isDerivative) {
     // Compute derivative approximate result
     result = Float<double>::Builder(function->approximateDerivative(abscissa, context, 0, false));
+  } else if (!m_exactValuesAreActivated) {
+    *memoizedLayoutAtIndex(index) = simplifiedLayoutForCell(column, row);
+    return;
   } else {
-    // Compute exact result
-    result = function->expressionReduced(context);
-    Poincare::VariableContext abscissaContext = Poincare::VariableContext(Shared::Function::k_unknownName, context);
-    Poincare::Expression abscissaExpression = Poincare::Decimal::Builder<double>(abscissa);
-    abscissaContext.setExpressionForSymbolAbstract(abscissaExpression, Symbol::Builder(Shared::Function::k_unknownName, strlen(Shared::Function::k_unknownName)));
-    bool simplificationFailure = false;
-    PoincareHelpers::CloneAndSimplify(
-        &result,
-        &abscissaContext,
-        Poincare::ReductionTarget::User,
-        Poincare::SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined,
-        Poincare::UnitConversion::Default,
-        Poincare::Preferences::sharedPreferences(),
-        true,
-        &simplificationFailure);
-    /* Approximate in case of simplification failure, as we cannot display a non-beautified expression. */
-    if (simplificationFailure || !m_exactValuesAreActivated || ExpressionDisplayPermissions::ShouldOnlyDisplayApproximation(function->originalEquation(), result, context)) {
-      // Do not show exact expressions in certain cases, use approximate result
-      result = PoincareHelpers::Approximate<double>(result, context);
+    Layout exactLayout = cachedExactLayout(recordAtColumn(column).checksum(), abscissa);
+    if (!exactLayout.isUninitialized()) {
+      *memoizedLayoutAtIndex(index) = exactLayout;
+      return;
     }
+    /* Display an approximation, which does not require any simplification,
+     * until computePendingExactLayouts replaces it. */
+    m_exactLayoutIsPending[index] = true;
+    Poincare::VariableContext abscissaContext = Poincare::VariableContext(Shared::Function::k_unknownName, context);
+    abscissaContext.setExpressionForSymbolAbstract(Poincare::Decimal::Builder<double>(abscissa), Symbol::Builder(Shared::Function::k_unknownName, strlen(Shared::Function::k_unknownName)));
+    result = PoincareHelpers::Approximate<double>(function->expressionReduced(context), &abscissaContext);
   }
   *memoizedLayoutAtIndex(index) = result.createLayout(Preferences::PrintFloatMode::Decimal, Preferences::VeryLargeNumberOfSignificantDigits, context);
 }
@@ -413,38 +439,125 @@ T * ValuesController::parameterController() {
   return m_functionParameterController;
 }
 
- bool ValuesController::exactValuesButtonAction() {
+bool ValuesController::exactValuesButtonAction() {
   assert(m_exactValuesButton.state() == m_exactValuesAreActivated);
-  /* Approximated values computation is much faster than exact values so it's
-   * uninterruptable and if the exact values computation is interrupted, it
-   * falls back on approximated values computation. */
+  /* Exact values are not computed here: cells display approximations until
+   * the exact values are computed, when the user is idle. */
   resetLayoutMemoization();
+  activateExactValues(!m_exactValuesAreActivated);
+  m_selectableTableView.reloadData();
+  return true;
+}
 
-  if (m_exactValuesAreActivated) {
-    activateExactValues(false);
-    resetLayoutMemoization();
+void ValuesController::activateExactValues(bool activate) {
+  m_exactValuesAreActivated = activate;
+  m_exactValuesButton.setState(m_exactValuesAreActivated);
+  for (int i = 0; i < k_numberOfCachedExactLayouts; i++) {
+    m_exactLayouts[i] = Layout();
+  }
+  m_nextCachedExactLayoutIndex = 0;
+}
+
+void ValuesController::computePendingExactLayouts() {
+  bool didComputeLayouts = false;
+  for (int index = 0; index < k_maxNumberOfMemoizedCells; index++) {
+    int column, row;
+    if (!m_exactLayoutIsPending[index] || !cellForMemoizedIndex(index, &column, &row)) {
+      continue;
+    }
+    Layout exactLayout;
+    {
+      /* Always use an ExceptionCheckpoint in case the simplification overflows
+       * the pool: the approximation is then kept. */
+      ExceptionCheckpoint ecp;
+      if (ExceptionRun(ecp)) {
+        /* Any key interrupts the computation, so that scrolling never waits
+         * for a simplification. It resumes when the user is idle again. */
+        CircuitBreakerCheckpoint checkpoint(Ion::CircuitBreaker::CheckpointType::AnyKey);
+        if (CircuitBreakerRun(checkpoint)) {
+          exactLayout = simplifiedLayoutForCell(column, row);
+        } else {
+          break;
+        }
+      }
+    }
+    m_exactLayoutIsPending[index] = false;
+    if (exactLayout.isUninitialized()) {
+      continue;
+    }
+    if (!didComputeLayouts) {
+      /* The selected cell is found with the table sizes: unhighlight it before
+       * they change, reloadData highlights it again. */
+      m_selectableTableView.unhighlightSelectedCell();
+    }
+    cacheExactLayout(recordAtColumn(column).checksum(), intervalAtColumn(column)->element(row - 1), exactLayout);
+    KDCoordinate previousWidth = columnWidth(column);
+    KDCoordinate previousHeight = rowHeight(row);
+    *memoizedLayoutAtIndex(index) = exactLayout;
+    updateSizeMemoizationForColumnAfterIndexChanged(column, previousWidth, row);
+    updateSizeMemoizationForRow(row, previousHeight);
+    didComputeLayouts = true;
+  }
+  if (didComputeLayouts) {
     m_selectableTableView.reloadData();
-    return true;
   }
+}
 
-  {
-    CircuitBreakerCheckpoint checkpoint(Ion::CircuitBreaker::CheckpointType::Back);
-    if (CircuitBreakerRun(checkpoint)) {
-      activateExactValues(true);
-      m_selectableTableView.reloadData();
-      return true;
-    } else {
-      activateExactValues(false);
-      resetLayoutMemoization();
-      m_selectableTableView.reloadData();
-      return false;
+Layout ValuesController::simplifiedLayoutForCell(int column, int row) {
+  double abscissa;
+  bool isDerivative = false;
+  Shared::ExpiringPointer<ContinuousFunction> function = functionAtIndex(column, row, &abscissa, &isDerivative);
+  assert(!isDerivative);
+  Poincare::Context * context = textFieldDelegateApp()->localContext();
+  Expression result = function->expressionReduced(context);
+  Poincare::VariableContext abscissaContext = Poincare::VariableContext(Shared::Function::k_unknownName, context);
+  Poincare::Expression abscissaExpression = Poincare::Decimal::Builder<double>(abscissa);
+  abscissaContext.setExpressionForSymbolAbstract(abscissaExpression, Symbol::Builder(Shared::Function::k_unknownName, strlen(Shared::Function::k_unknownName)));
+  bool simplificationFailure = false;
+  PoincareHelpers::CloneAndSimplify(
+      &result,
+      &abscissaContext,
+      Poincare::ReductionTarget::User,
+      Poincare::SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined,
+      Poincare::UnitConversion::Default,
+      Poincare::Preferences::sharedPreferences(),
+      true,
+      &simplificationFailure);
+  /* Approximate in case of simplification failure, as we cannot display a non-beautified expression. */
+  if (simplificationFailure || !m_exactValuesAreActivated || ExpressionDisplayPermissions::ShouldOnlyDisplayApproximation(function->originalEquation(), result, context)) {
+    // Do not show exact expressions in certain cases, use approximate result
+    result = PoincareHelpers::Approximate<double>(result, context);
+  }
+  return result.createLayout(Preferences::PrintFloatMode::Decimal, Preferences::VeryLargeNumberOfSignificantDigits, context);
+}
+
+Layout ValuesController::knownLayoutForCell(int column, int row) {
+  if (layoutIsMemoizedForCell(column, row)) {
+    return memoizedLayoutForCell(column, row);
+  }
+  bool isDerivative = false;
+  Ion::Storage::Record record = recordAtColumn(column, &isDerivative);
+  if (isDerivative) {
+    return Layout();
+  }
+  return cachedExactLayout(record.checksum(), intervalAtColumn(column)->element(row - 1));
+}
+
+Layout ValuesController::cachedExactLayout(uint32_t checksum, double abscissa) const {
+  for (int i = 0; i < k_numberOfCachedExactLayouts; i++) {
+    if (!m_exactLayouts[i].isUninitialized() && m_exactLayoutChecksums[i] == checksum && m_exactLayoutAbscissas[i] == abscissa) {
+      return m_exactLayouts[i];
     }
   }
+  return Layout();
 }
 
-void ValuesController::activateExactValues(bool activate) {
-  m_exactValuesAreActivated = activate;
-  m_exactValuesButton.setState(m_exactValuesAreActivated);
+void ValuesController::cacheExactLayout(uint32_t checksum, double abscissa, Layout layout) {
+  // The oldest layout is replaced
+  m_exactLayoutChecksums[m_nextCachedExactLayoutIndex] = checksum;
+  m_exactLayoutAbscissas[m_nextCachedExactLayoutIndex] = abscissa;
+  m_exactLayouts[m_nextCachedExactLayoutIndex] = layout;
+  m_nextCachedExactLayoutIndex = (m_nextCachedExactLayoutIndex + 1) % k_numberOfCachedExactLayouts;
 }
 
 Ion::Storage::Record ValuesController::recordAtColumn(int i, bool * isDerivative) {
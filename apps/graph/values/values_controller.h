@@ -24,6 +24,9 @@ public:
   // View controller
   void viewDidDisappear() override;
 
+  // Responder
+  bool handleEvent(Ion::Events::Event event) override;
+
   // TableViewDataSource
   void willDisplayCellAtLocation(Escher::HighlightCell * cell, int i, int j) override;
   int typeAtLocation(int i, int j) override;
@@ -51,6 +54,8 @@ private:
   constexpr static int k_maxNumberOfDisplayableSymbolTypes = 2;
   constexpr static int k_maxNumberOfDisplayableAbscissaCells = k_maxNumberOfDisplayableSymbolTypes * k_maxNumberOfDisplayableRows;
   constexpr static int k_maxNumberOfDisplayableCells = k_maxNumberOfDisplayableFunctions * k_maxNumberOfDisplayableRows;
+  constexpr static int k_maxNumberOfMemoizedCells = k_maxNumberOfDisplayableFunctions * k_numberOfMemoizedRows;
+  constexpr static int k_numberOfCachedExactLayouts = k_maxNumberOfDisplayableCells;
   constexpr static int k_valuesCellBufferSize = 2 * Poincare::PrintFloat::charSizeForFloatsWithPrecision(Poincare::Preferences::VeryLargeNumberOfSignificantDigits) + 3; // The largest buffer holds (-1.234567E-123;-1.234567E-123)
   constexpr static KDCoordinate k_maxColumnWidth = 2 * k_cellWidth;
   constexpr static KDCoordinate k_maxRowHeight = 5 * k_cellHeight;
@@ -103,6 +108,12 @@ private:
   template <class T> T * parameterController();
   bool exactValuesButtonAction();
   void activateExactValues(bool activate);
+  void computePendingExactLayouts();
+  Poincare::Layout simplifiedLayoutForCell(int column, int row);
+  // Layout of a value cell if it is memoized or cached, without computing it
+  Poincare::Layout knownLayoutForCell(int column, int row);
+  Poincare::Layout cachedExactLayout(uint32_t checksum, double abscissa) const;
+  void cacheExactLayout(uint32_t checksum, double abscissa, Poincare::Layout layout);
   Ion::Storage::Record recordAtColumn(int i, bool * isDerivative);
   Shared::ExpiringPointer<Shared::ContinuousFunction> functionAtIndex(int column, int row, double * abscissa, bool * isDerivative);
   int numberOfColumnsForRecord(Ion::Storage::Record record) const;
@@ -122,9 +133,22 @@ private:
   Escher::ButtonState m_exactValuesButton;
   Escher::ToggleableDotView m_exactValuesDotView;
   Escher::ShortMemoizedColumnWidthManager m_widthManager;
-  Escher::LongMemoizedRowHeightManager m_heightManager;
+  // The title row, the elements and the last empty row are indexed
+#if SHARED_INTERVAL_MAX_NUMBER_OF_ELEMENTS + 2 > 128
+  Escher::PrefixSumVeryLongRowHeightManager m_heightManager;
+#else
+  Escher::PrefixSumLongRowHeightManager m_heightManager;
+#endif
   bool m_exactValuesAreActivated;
-  mutable Poincare::Layout m_memoizedLayouts[k_maxNumberOfDisplayableCells];
+  mutable Poincare::Layout m_memoizedLayouts[k_maxNumberOfMemoizedCells];
+  /* When exact values are activated, memoized cells first hold approximations.
+   * Exact layouts are computed when the user is idle, and are cached by
+   * function record checksum and abscissa. */
+  bool m_exactLayoutIsPending[k_maxNumberOfMemoizedCells];
+  Poincare::Layout m_exactLayouts[k_numberOfCachedExactLayouts];
+  uint32_t m_exactLayoutChecksums[k_numberOfCachedExactLayouts];
+  double m_exactLayoutAbscissas[k_numberOfCachedExactLayouts];
+  int m_nextCachedExactLayoutIndex;
 };
 
 }
@@ -6,7 +6,7 @@
 
 namespace Inference {
 
-static_assert(sizeof(GoodnessTest) < sizeof(HomogeneityTest), "Make sure this size increase was decided");
+static_assert(sizeof(HomogeneityTest) < sizeof(GoodnessTest), "Make sure this size increase was decided");
 
 GoodnessTest::GoodnessTest() {
   for (int i = 0; i < k_maxNumberOfRows * k_maxNumberOfColumns; i++) {
@@ -6,10 +6,50 @@
 
 namespace Inference {
 
-HomogeneityTest::HomogeneityTest() {
+HomogeneityTest::HomogeneityTest() :
+  m_total(0.),
+  m_numberOfResultRows(0),
+  m_numberOfResultColumns(0)
+{
   for (int i = 0; i < numberOfStatisticParameters(); i++) {
     m_input[i] = k_undefinedValue;
-    m_expectedValues[i] = k_undefinedValue;
+  }
+  for (int row = 0; row < k_maxNumberOfRows; row++) {
+    m_rowTotals[row] = 0.;
+    m_numberOfValuesInRow[row] = 0;
+  }
+  for (int col = 0; col < k_maxNumberOfColumns; col++) {
+    m_columnTotals[col] = 0.;
+    m_numberOfValuesInColumn[col] = 0;
+  }
+}
+
+void HomogeneityTest::setParameterAtIndex(double f, int i) {
+  double previous = parameterAtIndex(i);
+  Chi2Test::setParameterAtIndex(f, i);
+  if (i >= numberOfStatisticParameters()) {
+    return;
+  }
+  Index2D position = indexToIndex2D(i);
+  int valuesDifference = !std::isnan(f) - !std::isnan(previous);
+  m_numberOfValuesInRow[position.row] += valuesDifference;
+  m_numberOfValuesInColumn[position.col] += valuesDifference;
+  /* The totals of the edited row and column are summed again rather than
+   * updated with the difference of values, which would be lost when adding a
+   * small value to a large total. */
+  m_rowTotals[position.row] = 0.;
+  for (int col = 0; col < k_maxNumberOfColumns; col++) {
+    double value = parameterAtPosition(position.row, col);
+    m_rowTotals[position.row] += std::isnan(value) ? 0. : value;
+  }
+  m_columnTotals[position.col] = 0.;
+  for (int row = 0; row < k_maxNumberOfRows; row++) {
+    double value = parameterAtPosition(row, position.col);
+    m_columnTotals[position.col] += std::isnan(value) ? 0. : value;
+  }
+  m_total = 0.;
+  for (int row = 0; row < k_maxNumberOfRows; row++) {
+    m_total += m_rowTotals[row];
   }
 }
 
@@ -29,30 +69,29 @@ bool HomogeneityTest::authorizedParameterAtIndex(double p, int i) const {
 }
 
 bool HomogeneityTest::deleteParameterAtPosition(int row, int column) {
-  if (Chi2Test::deleteParameterAtPosition(row, column)) {
-    return true;
-  }
-  for (int j = 0; j < k_maxNumberOfRows; j++) {
-    if (j != row && !std::isnan(parameterAtPosition(j, column))) {
-      // There is another non deleted value in this column
-      return false;
-    }
+  if (std::isnan(parameterAtPosition(row, column))) {
+    // Param is already deleted
+    return false;
   }
-  return true;
+  setParameterAtPosition(k_undefinedValue, row, column);
+  return m_numberOfValuesInRow[row] == 0 || m_numberOfValuesInColumn[column] == 0;
 }
 
 void HomogeneityTest::compute() {
   Index2D max = computeInnerDimensions();
   m_numberOfResultRows = max.row;
   m_numberOfResultColumns = max.col;
-  computeExpectedValues(max);
   m_testCriticalValue = computeChi2();
   m_degreesOfFreedom = computeDegreesOfFreedom(max);
   m_pValue = SignificanceTest::ComputePValue(this);
 }
 
 double HomogeneityTest::expectedValueAtLocation(int row, int column) {
-  return m_expectedValues[index2DToIndex(row, column)];
+  if (row >= m_numberOfResultRows || column >= m_numberOfResultColumns) {
+    return k_undefinedValue;
+  }
+  // Note : Divide before multiplying to avoid some cases of double overflow
+  return (m_rowTotals[row] / m_total) * m_columnTotals[column];
 }
 
 double HomogeneityTest::contributionAtLocation(int row, int column) {
@@ -66,7 +105,8 @@ double HomogeneityTest::observedValue(int resultsIndex) const {
 }
 
 double HomogeneityTest::expectedValue(int resultsIndex) const {
-  return m_expectedValues[resultsIndexToArrayIndex(resultsIndex)];
+  Index2D position = resultsIndexToIndex2D(resultsIndex);
+  return (m_rowTotals[position.row] / m_total) * m_columnTotals[position.col];
 }
 
 int HomogeneityTest::computeDegreesOfFreedom(Index2D max) {
@@ -74,8 +114,7 @@ int HomogeneityTest::computeDegreesOfFreedom(Index2D max) {
 }
 
 int HomogeneityTest::numberOfValuePairs() const {
-  Index2D max = computeInnerDimensions();
-  return max.row * max.col;
+  return m_numberOfResultRows * m_numberOfResultColumns;
 }
 
 HomogeneityTest::Index2D HomogeneityTest::resultsIndexToIndex2D(int resultsIndex) const {
@@ -88,34 +127,6 @@ int HomogeneityTest::resultsIndexToArrayIndex(int resultsIndex) const {
   return index2DToIndex(resultsIndexToIndex2D(resultsIndex));
 }
 
-void HomogeneityTest::computeExpectedValues(Index2D max) {
-  // Compute row, column and overall sums
-  m_total = 0;
-  for (int row = 0; row < max.row; row++) {
-    for (int col = 0; col < max.col; col++) {
-      // int index = index2DToIndex(row, col);
-      if (row == 0) {
-        m_columnTotals[col] = 0;
-      }
-      if (col == 0) {
-        m_rowTotals[row] = 0;
-      }
-      double p = parameterAtPosition(row, col);
-      m_columnTotals[col] += p;
-      m_rowTotals[row] += p;
-      m_total += p;
-    }
-  }
-  // Then fill array
-  for (int row = 0; row < max.row; row++) {
-    for (int col = 0; col < max.col; col++) {
-      int index = index2DToIndex(row, col);
-      // Note : Divide before multiplying to avoid some cases of double overflow
-      m_expectedValues[index] = (m_rowTotals[row] / m_total) * m_columnTotals[col];
-    }
-  }
-}
-
 void HomogeneityTest::recomputeData() {
   // Remove empty rows / columns
   Index2D dimensions = computeInnerDimensions();
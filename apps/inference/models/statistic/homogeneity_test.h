@@ -1,6 +1,7 @@
 #ifndef INFERENCE_MODELS_STATISTIC_HOMOGENEITY_TEST_H
 #define INFERENCE_MODELS_STATISTIC_HOMOGENEITY_TEST_H
 
+#include <stdint.h>
 #include "chi2_test.h"
 
 namespace Inference {
@@ -17,6 +18,7 @@ public:
   void setGraphTitle(char * buffer, size_t bufferSize) const override;
 
   // Statistic
+  void setParameterAtIndex(double f, int i) override;
   bool validateInputs() override;
   // Test
   void compute() override;
@@ -52,14 +54,17 @@ private:
 
   int computeDegreesOfFreedom(Index2D max);
   double * parametersArray() override { return m_input; }
-  void computeExpectedValues(Index2D max);
   Index2D initialDimensions() const override { return Index2D{.row = 2, .col = 2}; }
 
   double m_input[k_maxNumberOfColumns * k_maxNumberOfRows];
-  double m_expectedValues[k_maxNumberOfColumns * k_maxNumberOfRows];
+  /* Totals and counts of defined values are updated on each cell edit, so that
+   * editing a cell only rescans its row and column. Undefined cells count as
+   * 0. */
   double m_rowTotals[k_maxNumberOfRows];
   double m_columnTotals[k_maxNumberOfColumns];
   double m_total;
+  uint8_t m_numberOfValuesInRow[k_maxNumberOfRows];
+  uint8_t m_numberOfValuesInColumn[k_maxNumberOfColumns];
   int m_numberOfResultRows;
   int m_numberOfResultColumns;
 };
@@ -570,6 +570,32 @@ QUIZ_CASE(probability_homogeneity_test) {
   }
 }
 
+QUIZ_CASE(probability_homogeneity_test_totals) {
+  HomogeneityTest test;
+  test.setParameterAtPosition(1, 0, 0);
+  test.setParameterAtPosition(2, 0, 1);
+  test.setParameterAtPosition(3, 1, 0);
+  test.setParameterAtPosition(4, 1, 1);
+  quiz_assert(test.rowTotal(0) == 3 && test.rowTotal(1) == 7);
+  quiz_assert(test.columnTotal(0) == 4 && test.columnTotal(1) == 6);
+  quiz_assert(test.total() == 10);
+  // Overwriting and deleting a cell update the totals of its row and column
+  test.setParameterAtPosition(5, 1, 1);
+  quiz_assert(test.rowTotal(1) == 8 && test.columnTotal(1) == 7 && test.total() == 11);
+  quiz_assert(!test.deleteParameterAtPosition(0, 1));
+  quiz_assert(test.rowTotal(0) == 1 && test.columnTotal(1) == 5 && test.total() == 9);
+  quiz_assert(test.deleteParameterAtPosition(0, 0));
+  quiz_assert(test.rowTotal(0) == 0 && test.columnTotal(0) == 3 && test.total() == 8);
+  // Compacting the table moves the totals along with the values
+  test.recomputeData();
+  quiz_assert(test.rowTotal(0) == 8 && test.rowTotal(1) == 0 && test.total() == 8);
+  // Replacing a large value does not lose the small ones
+  test.setParameterAtPosition(1e20, 0, 0);
+  test.setParameterAtPosition(5, 0, 1);
+  test.setParameterAtPosition(1, 0, 0);
+  quiz_assert(test.rowTotal(0) == 6 && test.columnTotal(0) == 1 && test.total() == 6);
+}
+
 QUIZ_CASE(probability_slope_t_statistic) {
   Shared::GlobalContext context;
   StatisticTestCase testCase;
@@ -1,6 +1,13 @@
 #include "apps_container.h"
 #include "global_preferences.h"
 #include <poincare/init.h>
+#if POINCARE_TREE_STATS
+#include <poincare/tree_pool.h>
+#endif
+#if ESCHER_REDRAW_PROFILER
+#include <escher/redraw_profiler.h>
+#include <iostream>
+#endif
 
 #define DUMMY_MAIN 0
 #if DUMMY_MAIN
@@ -36,12 +43,33 @@ void ion_main(int argc, const char * const argv[]) {
 void ion_main(int argc, const char * const argv[]) {
   // Initialize Poincare::TreePool::sharedPool
   Poincare::Init();
+#if POINCARE_TREE_STATS
+  bool logTreePoolStatistics = false;
+#endif
 
 #if EPSILON_GETOPT
   for (int i=1; i<argc; i++) {
     if (argv[i][0] != '-' || argv[i][1] != '-') {
       continue;
     }
+#if POINCARE_TREE_STATS
+    /* Option to log the TreePool statistics on exit:
+     * $ ./epsilon.elf --tree-pool-stats
+     */
+    if (strcmp(argv[i], "--tree-pool-stats") == 0) {
+      logTreePoolStatistics = true;
+      continue;
+    }
+#endif
+#if ESCHER_REDRAW_PROFILER
+    /* Option to profile the redraws and log a summary per view class on exit:
+     * $ ./epsilon.elf --redraw-stats
+     */
+    if (strcmp(argv[i], "--redraw-stats") == 0) {
+      Escher::RedrawProfiler::sharedProfiler()->setEnabled(true);
+      continue;
+    }
+#endif
     /* Option should be given at run-time:
      * $ ./epsilon.elf --language fr
      */
@@ -105,6 +133,16 @@ void ion_main(int argc, const char * const argv[]) {
   Ion::setStackStart((void *)(&stackTop));
 
   AppsContainer::sharedAppsContainer()->run();
+#if POINCARE_TREE_STATS
+  if (logTreePoolStatistics) {
+    Poincare::TreePool::sharedPool()->statisticsLog(std::cerr);
+  }
+#endif
+#if ESCHER_REDRAW_PROFILER
+  if (Escher::RedrawProfiler::sharedProfiler()->isEnabled()) {
+    Escher::RedrawProfiler::sharedProfiler()->log(std::cerr);
+  }
+#endif
 }
 
 #endif
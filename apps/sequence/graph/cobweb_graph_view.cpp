@@ -65,13 +65,17 @@ void CobwebPlotPolicy::drawPlot(const AbstractPlotView * plotView, KDContext * c
     CurveDrawing plot(Curve2D(evaluateFunction, &function), context, xMin, xMax, plotView->pixelWidth(), fadedColor);
     plot.draw(plotView, ctx, rect);
     plotView->drawSegment(ctx, rect, {xMin, xMin}, {xMax, xMax}, fadedColor, true);
+    for (int i = 0; i <= k_maximumNumberOfSteps; i++) {
+      m_terms[i] = sequence->evaluateXYAtParameter(static_cast<float>(sequence->initialRank() + i), context).x2();
+    }
   }
+  assert(m_step < k_maximumNumberOfSteps);
   bool increasing = shouldUpdate() && m_cachedStep == m_step - 1;
   int initialStep = increasing ? m_cachedStep : (shouldUpdate() ? m_step : 0);
   int rank = sequence->initialRank() + initialStep;
-  float x = increasing ? m_x : sequence->evaluateXYAtParameter(static_cast<float>(rank), context).x2();
+  float x = increasing ? m_x : m_terms[initialStep];
   float y = rank == sequence->initialRank() ? 0 : x;
-  float uOfX = sequence->evaluateXYAtParameter(static_cast<float>(rank+1), context).x2();
+  float uOfX = m_terms[initialStep + 1];
   KDMeasuringContext measuringContext(*ctx);
   for (int i = initialStep; i < m_step; i++) {
     rank++;
@@ -80,7 +84,7 @@ void CobwebPlotPolicy::drawPlot(const AbstractPlotView * plotView, KDContext * c
     m_verticalLineCache[i].save(ctx, measuringContext.writtenRect());
     plotView->drawDashedStraightSegment(ctx, rect, AbstractPlotView::Axis::Vertical, x, y, uOfX, sequence->color());
     y = uOfX;
-    float uOfuOfX = sequence->evaluateXYAtParameter(static_cast<float>(rank+1), context).x2();
+    float uOfuOfX = m_terms[i + 2];
     measuringContext.reset();
     plotView->drawDashedStraightSegment(&measuringContext, rect, AbstractPlotView::Axis::Horizontal, y, x, uOfX, sequence->color());
     m_horizontalLineCache[i].save(ctx, measuringContext.writtenRect());
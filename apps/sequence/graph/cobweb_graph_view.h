@@ -34,6 +34,8 @@ private:
   constexpr static KDCoordinate k_maxHeight = Ion::Display::Height - Escher::Metric::TitleBarHeight - Escher::Metric::StackTitleHeight;
   // Cache to store parts of the drawing to be removed at the next step
   mutable float m_x;
+  // Terms from the initial rank, computed when the whole plot is drawn
+  mutable float m_terms[k_maximumNumberOfSteps + 1];
   mutable KDPixelCache<k_diameter * k_diameter> m_dotCache;
   mutable KDPixelCache<Ion::Display::Width * k_thickness> m_horizontalLineCache[k_maximumNumberOfSteps];
   mutable KDPixelCache<k_maxHeight * k_thickness> m_verticalLineCache[k_maximumNumberOfSteps];
@@ -1,4 +1,5 @@
 #include "graph_view.h"
+#include <assert.h>
 #include <cmath>
 
 using namespace Poincare;
@@ -8,17 +9,30 @@ namespace Sequence {
 
 GraphView::GraphView(SequenceStore * sequenceStore, InteractiveCurveViewRange * graphRange, CurveViewCursor * cursor, BannerView * bannerView, CursorView * cursorView) :
   FunctionGraphView(graphRange, cursor, bannerView, cursorView),
-  m_sequenceStore(sequenceStore)
+  m_sequenceStore(sequenceStore),
+  m_numberOfTerms(-1),
+  m_computedSequenceIndex(-1)
 {}
 
 void GraphView::drawRecord(Ion::Storage::Record record, int index, KDContext * ctx, KDRect rect, bool firstDrawnRecord) const {
+  if (firstDrawnRecord) {
+    m_numberOfTerms = -1;
+    m_computedSequenceIndex = -1;
+  }
+  /* The terms are computed again if the computation was interrupted while
+   * drawing a previous record. */
+  if (m_numberOfTerms < 0) {
+    computeTerms();
+  }
+  assert(index < SequenceStore::k_maxNumberOfSequences);
   Shared::Sequence * s = m_sequenceStore->modelForRecord(record);
 
   float xStep = std::ceil(pixelWidth());
   float xMin = range()->xMin(), xMax = range()->xMax();
 
-  for (int x = xMin; x <= xMax; x += xStep) {
-    float y = s->evaluateXYAtParameter(static_cast<float>(x), context()).x2();
+  int i = 0;
+  for (int x = xMin; x <= xMax && i < m_numberOfTerms; x += xStep, i++) {
+    float y = m_terms[index][i];
     if (std::isnan(y)) {
       continue;
     }
@@ -30,4 +44,30 @@ void GraphView::drawRecord(Ion::Storage::Record record, int index, KDContext * c
   }
 }
 
+void GraphView::computeTerms() const {
+  int numberOfSequences = numberOfDrawnRecords();
+  assert(numberOfSequences <= SequenceStore::k_maxNumberOfSequences);
+  Shared::Sequence * sequences[SequenceStore::k_maxNumberOfSequences];
+  for (int j = 0; j < numberOfSequences; j++) {
+    sequences[j] = m_sequenceStore->modelForRecord(m_sequenceStore->activeRecordAtIndex(j));
+  }
+
+  float xStep = std::ceil(pixelWidth());
+  float xMin = range()->xMin(), xMax = range()->xMax();
+
+  int i = 0;
+  for (int x = xMin; x <= xMax && i < k_maxNumberOfTerms; x += xStep, i++) {
+    for (int j = 0; j < numberOfSequences; j++) {
+      if (functionWasInterrupted(j)) {
+        m_terms[j][i] = NAN;
+        continue;
+      }
+      m_computedSequenceIndex = j;
+      m_terms[j][i] = sequences[j]->evaluateXYAtParameter(static_cast<float>(x), context()).x2();
+    }
+  }
+  m_computedSequenceIndex = -1;
+  m_numberOfTerms = i;
+}
+
 }
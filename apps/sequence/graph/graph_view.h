@@ -14,13 +14,25 @@ public:
   int numberOfDrawnRecords() const override { return m_sequenceStore->numberOfActiveFunctions(); }
   void drawRecord(Ion::Storage::Record record, int index, KDContext * ctx, KDRect rect, bool firstDrawnRecord) const override;
   void tidyModel(int i) const override { m_sequenceStore->modelForRecord(m_sequenceStore->activeRecordAtIndex(i))->tidyDownstreamPoolFrom(); }
+  int interruptedRecordIndex(int i) const override { return m_computedSequenceIndex < 0 ? i : m_computedSequenceIndex; }
   int selectedRecordIndex() const override {
     return m_sequenceStore->indexOfRecordAmongActiveRecords(m_selectedRecord);
   }
   Shared::FunctionStore * functionStore() const override { return m_sequenceStore; }
 
 private:
+  /* Dots are drawn at most every pixel, from the left to the right of the
+   * window, plus the one before xMin when it is rounded towards 0. */
+  constexpr static int k_maxNumberOfTerms = Ion::Display::Width + 2;
+  /* The terms of all sequences are computed at once, rank after rank, so that
+   * the sequence context steps through the window only once. The sequences
+   * interrupted by the user are skipped. */
+  void computeTerms() const;
   Shared::SequenceStore * m_sequenceStore;
+  mutable float m_terms[Shared::SequenceStore::k_maxNumberOfSequences][k_maxNumberOfTerms];
+  mutable int m_numberOfTerms;
+  // Index of the sequence whose terms are being computed, -1 otherwise
+  mutable int m_computedSequenceIndex;
 };
 
 }
@@ -554,6 +554,51 @@ QUIZ_CASE(sequence_sum_evaluation) {
   check_sum_of_sequence_between_bounds(92.0, 2.0, 7.0, Sequence::Type::DoubleRecurrence, "u(n)+u(n+1)+2", "0", "0");
 }
 
+void assert_sequence_value_at_rank(Sequence * u, int rank, double value, SequenceContext * sequenceContext) {
+  quiz_assert(u->evaluateXYAtParameter(static_cast<double>(rank), sequenceContext).x2() == value);
+}
+
+QUIZ_CASE(sequence_fast_forward_evaluation) {
+  Shared::GlobalContext globalContext;
+  SequenceStore * store = globalContext.sequenceStore();
+  SequenceContext * sequenceContext = globalContext.sequenceContext();
+
+  // Affine recurrences are evaluated beyond the maximal number of steps
+  Sequence * u = addSequence(store, Sequence::Type::SingleRecurrence, "u(n)+3", "2", nullptr, sequenceContext);
+  assert_sequence_value_at_rank(u, 5000, 15002.0, sequenceContext);
+  assert_sequence_value_at_rank(u, 100000, 300002.0, sequenceContext);
+  store->removeAll();
+  sequenceContext->resetCache();
+  u = addSequence(store, Sequence::Type::SingleRecurrence, "2u(n)+1", "0", nullptr, sequenceContext);
+  assert_sequence_value_at_rank(u, 40, 1099511627775.0, sequenceContext);
+  store->removeAll();
+  sequenceContext->resetCache();
+  u = addSequence(store, Sequence::Type::DoubleRecurrence, "u(n+1)+u(n)", "0", "1", sequenceContext);
+  double coefficients[3];
+  double initialValues[2];
+  quiz_assert(u->affineRecurrence<double>(sequenceContext, coefficients, initialValues));
+  quiz_assert(coefficients[0] == 1.0 && coefficients[1] == 1.0 && coefficients[2] == 0.0);
+  quiz_assert(initialValues[0] == 0.0 && initialValues[1] == 1.0);
+  assert_sequence_value_at_rank(u, 50, 12586269025.0, sequenceContext);
+  assert_sequence_value_at_rank(u, 2, 1.0, sequenceContext);
+  store->removeAll();
+  sequenceContext->resetCache();
+
+  // Random terms are drawn at each rank
+  u = addSequence(store, Sequence::Type::SingleRecurrence, "u(n)+random()", "0", nullptr, sequenceContext);
+  quiz_assert(!u->affineRecurrence<double>(sequenceContext, coefficients, initialValues));
+  store->removeAll();
+  sequenceContext->resetCache();
+
+  // Other recurrences resume from the closest checkpoint
+  u = addSequence(store, Sequence::Type::SingleRecurrence, "u(n)+n", "0", nullptr, sequenceContext);
+  assert_sequence_value_at_rank(u, 5000, 12497500.0, sequenceContext);
+  assert_sequence_value_at_rank(u, 4000, 7998000.0, sequenceContext);
+  assert_sequence_value_at_rank(u, 4001, 8002000.0, sequenceContext);
+  store->removeAll();
+  store->tidyDownstreamPoolFrom();
+}
+
 QUIZ_CASE(sequence_simply_recursive) {
   Shared::GlobalContext globalContext;
   SequenceStore * store = globalContext.sequenceStore();
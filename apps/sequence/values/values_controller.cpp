@@ -48,7 +48,7 @@ bool ValuesController::setDataAtLocation(double floatBody, int columnIndex, int
 // Shared::ValuesController
 
 Poincare::Layout * ValuesController::memoizedLayoutAtIndex(int i) {
-  assert(i >= 0 && i < k_maxNumberOfDisplayableCells);
+  assert(i >= 0 && i < k_maxNumberOfMemoizedCells);
   return &m_memoizedLayouts[i];
 }
 
@@ -25,6 +25,7 @@ public:
 private:
   constexpr static int k_maxNumberOfDisplayableSequences = 3;
   constexpr static int k_maxNumberOfDisplayableCells = k_maxNumberOfDisplayableSequences * k_maxNumberOfDisplayableRows;
+  constexpr static int k_maxNumberOfMemoizedCells = k_maxNumberOfDisplayableSequences * k_numberOfMemoizedRows;
   constexpr static int k_valuesCellBufferSize = Poincare::PrintFloat::charSizeForFloatsWithPrecision(Poincare::Preferences::VeryLargeNumberOfSignificantDigits);
 
   // TableViewDataSource
@@ -35,7 +36,7 @@ private:
   int fillColumnName(int columnIndex, char * buffer) override;
 
   // EditableCellTableViewController
-  bool checkDataAtLocation(double floatBody, int columnIndex, int rowIndex) const override { return floatBody >= 0.0; }
+  bool checkDataAtLocation(double floatBody, int columnIndex, int rowIndex) const override { return floatBody >= 0.0 && Shared::ValuesController::checkDataAtLocation(floatBody, columnIndex, rowIndex); }
   bool setDataAtLocation(double floatBody, int columnIndex, int rowIndex) override;
 
   // Shared::ValuesController
@@ -66,7 +67,7 @@ private:
 
   IntervalParameterController m_intervalParameterController;
   Escher::AbstractButtonCell m_setIntervalButton;
-  mutable Poincare::Layout m_memoizedLayouts[k_maxNumberOfDisplayableCells];
+  mutable Poincare::Layout m_memoizedLayouts[k_maxNumberOfMemoizedCells];
 
   Escher::RegularTableSize1DManager m_widthManager;
   Escher::RegularTableSize1DManager m_heightManager;
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <assert.h>
 #include <stddef.h>
+#include <string.h>
 #include <ion.h>
 #include <algorithm>
 
@@ -36,6 +37,18 @@ void DoublePairStore::initListsFromStorage(bool seriesShouldUpdate) {
     for (int i = 0; i < k_numberOfColumnsPerSeries; i++) {
       // Get the data of X1, Y1, X2, Y2, V1, V2, etc. from storage
       fillColumnName(s, i, listName);
+      /* A binary list record is only written when a Python script exports a
+       * list, so it is more recent than the lis record of the same name. It is
+       * imported once: it is destroyed as soon as the lis record holds its
+       * values, and can never override a list edited afterwards. */
+      Record binaryRecord = Record(listName, blsExtension);
+      if (FileSystem::sharedFileSystem()->hasRecord(binaryRecord)) {
+        setListFromBinaryData(binaryRecord.value(), s, i);
+        if (storeColumn(s, i)) {
+          binaryRecord.destroy();
+        }
+        continue;
+      }
       Record r = Record(listName, lisExtension);
       Record::Data listData = r.value();
       if (listData.size == 0) {
@@ -53,6 +66,22 @@ void DoublePairStore::initListsFromStorage(bool seriesShouldUpdate) {
   }
 }
 
+void DoublePairStore::setListFromBinaryData(Record::Data data, int series, int i) {
+  assert(series >= 0 && series < k_numberOfSeries);
+  assert(i == 0 || i == 1);
+  m_dataLists[series][i] = FloatList<double>::Builder();
+  /* The values are copied one by one since the record data is not guaranteed
+   * to be aligned on doubles. Values beyond the capacity of the store are
+   * dropped. */
+  int length = std::min(data.size / sizeof(double), static_cast<size_t>(k_maxNumberOfPairs));
+  const char * values = static_cast<const char *>(data.buffer);
+  for (int j = 0; j < length; j++) {
+    double value;
+    memcpy(&value, values + j * sizeof(double), sizeof(double));
+    set(value, series, i, j, true, true);
+  }
+}
+
 void DoublePairStore::tidy() {
   for (int serie = 0; serie < k_numberOfSeries ; serie++) {
     for (int i = 0; i < k_numberOfColumnsPerSeries ; i++) {
@@ -320,37 +349,27 @@ uint32_t DoublePairStore::storeChecksum() const {
   return Ion::crc32Word(checkSumPerSeries, k_numberOfSeries);
 }
 
-/* TODO: This function is temporary. We want to create a function with a
- * similar behaviour in Ion in a near future.
- * This was copy pasted from the crc32EatByte function in the kernel. */
-constexpr uint32_t polynomialForCrc = 0x04C11DB7;
-uint32_t crc32EatByte(uint32_t crc, uint8_t data) {
-    crc ^= data << 24;
-    for (int i=8; i--;) {
-      crc = crc & 0x80000000 ? ((crc<<1)^polynomialForCrc) : (crc << 1);
-    }
-    return crc;
-}
-
 uint32_t DoublePairStore::storeChecksumForSeries(int series) const {
-  /* Since the pool is not packed, it's noisy and we cannot just compute
-   * the CRC32 of the expressionNode in the pool.
-   * So we have to build it from the values of the columns. */
-  uint32_t crc = 0;
   /* If serie is not valid, it can mean it has been hidden
    * thus checksum must change. */
   if (numberOfPairsOfSeries(series) == 0 || !seriesIsActive(series)) {
-    return crc;
+    return 0;
   }
-  for (int j = 0; j < numberOfPairsOfSeries(series); j++) {
-    for (int i = 0; i < k_numberOfColumnsPerSeries; i++) {
-      double value = get(series, i, j);
-      for (size_t index = 0; index < sizeof(double) / sizeof(uint8_t); index++) {
-        crc = crc32EatByte(crc, *(reinterpret_cast<uint8_t *>(&value) + index));
-      }
-    }
+  /* The lists are stored each time they are modified, so their versions
+   * change with their values. Without the dependency graph, every change of
+   * the storage is a new version, so the lists records are hashed instead. */
+  uint32_t versions[k_numberOfColumnsPerSeries];
+  char name[k_columnNamesLength + 1];
+  for (int i = 0; i < k_numberOfColumnsPerSeries; i++) {
+    int nameLength = fillColumnName(series, i, name);
+#if SHARED_SYMBOL_DEPENDENCY_GRAPH
+    versions[i] = m_context->dependencyGraph()->versionOfBaseName(name, nameLength);
+#else
+    (void)nameLength;
+    versions[i] = Record(name, lisExtension).checksum();
+#endif
   }
-  return crc;
+  return Ion::crc32Word(versions, k_numberOfColumnsPerSeries);
 }
 
 double DoublePairStore::defaultValue(int series, int i, int j) const {
@@ -385,7 +404,10 @@ bool DoublePairStore::storeColumn(int series, int i) const {
     return true;
   }
   Symbol listSymbol = Symbol::Builder(name, nameLength);
-  return m_context->setExpressionForSymbolAbstract(m_dataLists[series][i], listSymbol);
+  if (!m_context->setExpressionForSymbolAbstract(m_dataLists[series][i], listSymbol)) {
+    return false;
+  }
+  return true;
 }
 
 void DoublePairStore::deleteTrailingUndef(int series, int i) {
@@ -84,11 +84,12 @@ public:
   void sortIndexByColumn(uint8_t * sortedIndex, int series, int column, int startIndex, int endIndex) const;
   double sumOfColumn(int series, int i, bool lnOfSeries = false) const;
 
-  /* WARNING: This checksum is too slow. Avoid using it if you can.
-  * Use it if you want to check that the list was modified outside this object
-  * (through the modification of lists in calculation for example).
-  * In other cases, you can use the method updateSeries, which is called
-  * each time a series is modified during the lifecycle of the store object. */
+  /* Use it if you want to check that the list was modified outside this object
+   * (through the modification of lists in calculation for example).
+   * It is computed from the versions of the lists in the dependency graph of
+   * the context, so it only changes when their content in the storage does.
+   * In other cases, you can use the method updateSeries, which is called
+   * each time a series is modified during the lifecycle of the store object. */
   uint32_t storeChecksum() const;
   uint32_t storeChecksumForSeries(int series) const;
 
@@ -120,6 +121,7 @@ protected:
 
 private:
   static_assert(k_maxNumberOfPairs <= UINT8_MAX, "k_maxNumberOfPairs is too large.");
+  void setListFromBinaryData(Ion::Storage::Record::Data data, int series, int i);
   bool storeColumn(int series, int i) const;
   void deleteTrailingUndef(int series, int i);
   void deletePairsOfUndef(int series);
@@ -16,11 +16,21 @@ Ion::Storage::Record ExpressionModelStore::recordAtIndex(int i) const {
 }
 
 ExpressionModelHandle * ExpressionModelStore::privateModelForRecord(Ion::Storage::Record record) const {
+  int emptyIndex = -1;
   for (int i = 0; i < maxNumberOfMemoizedModels(); i++) {
-    if (!memoizedModelAtIndex(i)->isNull() && *memoizedModelAtIndex(i) == record) {
-      return memoizedModelAtIndex(i);
+    ExpressionModelHandle * model = memoizedModelAtIndex(i);
+    if (model->isNull()) {
+      if (emptyIndex < 0) {
+        emptyIndex = i;
+      }
+    } else if (*model == record) {
+      return model;
     }
   }
+  if (emptyIndex >= 0) {
+    // Models reset by a change of what they depend on leave their slot empty
+    return setMemoizedModelAtIndex(emptyIndex, record);
+  }
   ExpressionModelHandle * result = setMemoizedModelAtIndex(m_oldestMemoizedIndex, record);
   m_oldestMemoizedIndex = (m_oldestMemoizedIndex+1) % maxNumberOfMemoizedModels();
   return result;
@@ -86,4 +96,14 @@ void ExpressionModelStore::resetMemoizedModelsExceptRecord(const Ion::Storage::R
   }
 }
 
+void ExpressionModelStore::storageDidChangeForRecord(const Ion::Storage::Record record, SymbolDependencyGraph * dependencyGraph, SymbolDependencyGraph::Version previousVersion) const {
+  Ion::Storage::Record emptyRecord;
+  for (int i = 0; i < maxNumberOfMemoizedModels(); i++) {
+    ExpressionModelHandle * model = memoizedModelAtIndex(i);
+    if (!model->isNull() && *model != record && dependencyGraph->versionOfRecord(*model) > previousVersion) {
+      setMemoizedModelAtIndex(i, emptyRecord);
+    }
+  }
+}
+
 }
@@ -3,6 +3,7 @@
 
 #include "expression_model_handle.h"
 #include "expiring_pointer.h"
+#include "symbol_dependency_graph.h"
 #include <ion/storage/file_system.h>
 #include <assert.h>
 
@@ -32,7 +33,12 @@ public:
 
   // Other
   virtual void tidyDownstreamPoolFrom(char * treePoolCursor = nullptr);
+  // Reset all the models, for models that are not tracked by the dependency graph
   void storageDidChangeForRecord(const Ion::Storage::Record record) const { resetMemoizedModelsExceptRecord(record); }
+  /* Reset the models depending on a record changed since previousVersion,
+   * except the model of the record written, which is up to date. The others
+   * keep their memoized expressions and caches. */
+  void storageDidChangeForRecord(const Ion::Storage::Record record, SymbolDependencyGraph * dependencyGraph, SymbolDependencyGraph::Version previousVersion) const;
 
 protected:
   virtual int maxNumberOfMemoizedModels() const = 0;
@@ -46,10 +52,11 @@ private:
   void resetMemoizedModelsExceptRecord(const Ion::Storage::Record record = Ion::Storage::Record()) const;
   virtual ExpressionModelHandle * setMemoizedModelAtIndex(int cacheIndex, Ion::Storage::Record) const = 0;
   virtual ExpressionModelHandle * memoizedModelAtIndex(int cacheIndex) const = 0;
-  /* When the required model is not present, we override the
-   * m_oldestMemoizedIndex model. This actually overrides the oldest memoized
-   * model because models are all reset at the same time. Otherwise, we should
-   * use a queue to decide which was the last memoized model. */
+  /* When the required model is not present, we use an empty slot, or override
+   * the m_oldestMemoizedIndex model if there is none. Since models are only
+   * reset when what they depend on changes, this is the oldest memoized model
+   * only if none was reset. Otherwise, we should use a queue to decide which
+   * was the last memoized model. */
   mutable int m_oldestMemoizedIndex;
 };
 
@@ -33,14 +33,23 @@ void FunctionGraphPolicy::drawPlot(const AbstractPlotView * plotView, KDContext
     // Get the record before the checkpoint because it can change the pool
     Ion::Storage::Record record = functionStore()->activeRecordAtIndex(index);
 
-    CircuitBreakerCheckpoint checkpoint(Ion::CircuitBreaker::CheckpointType::Back);
-    if (CircuitBreakerRun(checkpoint)) {
-      drawRecord(record, index, ctx, rect, firstDrawnRecord);
-    } else {
-      setFunctionInterrupted(index);
-      tidyModel(index);
-      m_context->tidyDownstreamPoolFrom();
-    }
+    bool drawAgain;
+    do {
+      drawAgain = false;
+      CircuitBreakerCheckpoint checkpoint(Ion::CircuitBreaker::CheckpointType::Back);
+      if (CircuitBreakerRun(checkpoint)) {
+        drawRecord(record, index, ctx, rect, firstDrawnRecord);
+      } else {
+        int interruptedIndex = interruptedRecordIndex(index);
+        bool wasInterrupted = functionWasInterrupted(interruptedIndex);
+        setFunctionInterrupted(interruptedIndex);
+        tidyModel(interruptedIndex);
+        m_context->tidyDownstreamPoolFrom();
+        /* Another record was being computed, the drawn one is drawn again
+         * without it. */
+        drawAgain = interruptedIndex != index && !wasInterrupted;
+      }
+    } while (drawAgain);
     firstDrawnRecord = false;
   }
 }
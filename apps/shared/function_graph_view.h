@@ -18,6 +18,8 @@ protected:
   virtual int numberOfDrawnRecords() const = 0;
   virtual void drawRecord(Ion::Storage::Record record, int index, KDContext *, KDRect, bool firstDrawnRecord) const = 0;
   virtual void tidyModel(int i) const = 0;
+  // Index of the record being computed when drawing the i-th was interrupted
+  virtual int interruptedRecordIndex(int i) const { return i; }
   virtual int selectedRecordIndex() const = 0;
   virtual FunctionStore * functionStore() const = 0;
 
@@ -30,9 +30,11 @@ ContinuousFunctionStore * GlobalContext::continuousFunctionStore() {
 }
 
 void GlobalContext::storageDidChangeForRecord(Ion::Storage::Record record) {
+  SymbolDependencyGraph::Version previousVersion = m_dependencyGraph.currentVersion();
+  m_dependencyGraph.storageDidChangeForRecord(record);
   m_sequenceContext.resetCache();
-  GlobalContext::sequenceStore()->storageDidChangeForRecord(record);
-  GlobalContext::continuousFunctionStore()->storageDidChangeForRecord(record);
+  GlobalContext::sequenceStore()->storageDidChangeForRecord(record, &m_dependencyGraph, previousVersion);
+  GlobalContext::continuousFunctionStore()->storageDidChangeForRecord(record, &m_dependencyGraph, previousVersion);
 }
 
 bool GlobalContext::SymbolAbstractNameIsFree(const char * baseName) {
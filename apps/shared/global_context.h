@@ -10,6 +10,7 @@
 #include <assert.h>
 #include "sequence_store.h"
 #include "sequence_context.h"
+#include "symbol_dependency_graph.h"
 
 namespace Shared {
 
@@ -37,6 +38,7 @@ public:
   static ContinuousFunctionStore * continuousFunctionStore();
   void storageDidChangeForRecord(const Ion::Storage::Record record);
   SequenceContext * sequenceContext() { return &m_sequenceContext; }
+  SymbolDependencyGraph * dependencyGraph() { return &m_dependencyGraph; }
   void tidyDownstreamPoolFrom(char * treePoolCursor = nullptr) override;
 private:
   // Expression getters
@@ -51,7 +53,7 @@ private:
   // Record getter
   static Ion::Storage::Record SymbolAbstractRecordWithBaseName(const char * name);
   SequenceContext m_sequenceContext;
-
+  SymbolDependencyGraph m_dependencyGraph;
 };
 
 }
@@ -7,7 +7,8 @@
 namespace Shared {
 
 Interval::Interval() :
-  m_numberOfElements(0)
+  m_numberOfElements(0),
+  m_isMaterialized(false)
 {
   reset();
 }
@@ -20,6 +21,7 @@ int Interval::numberOfElements() {
 void Interval::deleteElementAtIndex(int index) {
   assert(!m_needCompute);
   assert(m_numberOfElements > 0);
+  materializeElements();
   for (int k = index; k < m_numberOfElements-1; k++) {
     m_intervalBuffer[k] = m_intervalBuffer[k+1];
   }
@@ -33,12 +35,13 @@ bool Interval::hasSameParameters(IntervalParameters parameters) {
 double Interval::element(int i) {
   assert(i >= 0 && i < numberOfElements());
   computeElements();
-  return m_intervalBuffer[i];
+  return m_isMaterialized ? m_intervalBuffer[i] : computeElement(i);
 }
 
 void Interval::setElement(int i, double f) {
-  assert(i <= numberOfElements() && i < k_maxNumberOfElements);
+  assert(i <= numberOfElements() && i < k_maxNumberOfEditableElements);
   computeElements();
+  materializeElements();
   m_intervalBuffer[i] = f;
   if (i == numberOfElements()) {
     m_numberOfElements++;
@@ -77,6 +80,23 @@ void Interval::computeElements() {
     m_numberOfElements = m_parameters.step() > 0 ? 1 + (m_parameters.end() - m_parameters.start())/m_parameters.step() : k_maxNumberOfElements;
     m_numberOfElements = m_numberOfElements > k_maxNumberOfElements || m_numberOfElements < 0 ? k_maxNumberOfElements : m_numberOfElements;
   }
+  m_isMaterialized = false;
+  m_needCompute = false;
+}
+
+void Interval::materializeElements() {
+  assert(!m_needCompute && canBeEdited());
+  if (m_isMaterialized) {
+    return;
+  }
+  for (int k = 0; k < m_numberOfElements; k++) {
+    m_intervalBuffer[k] = computeElement(k);
+  }
+  m_isMaterialized = true;
+}
+
+double Interval::computeElement(int i) const {
+  assert(i >= 0 && i < m_numberOfElements);
   /* Even though elements are displayed with 7 significant digits, we round the
    * element to 14 significant digits to prevent unexpected imprecisions due to
    * doubles. For example, with start=-0.2 and step=0.2, 6th element is
@@ -85,19 +105,13 @@ void Interval::computeElements() {
   static_assert(precision == 14, "ratioThreshold value should be updated");
   // Save some calls to std::pow(10.0, -precision)
   constexpr double ratioThreshold = 10e-14;
-  bool checkForElementZero = (m_parameters.start() < 0.0);
-  for (int i = 0; i < m_numberOfElements; i += 1) {
-    if (checkForElementZero && i > 0 && std::abs(1.0 + m_parameters.start() / (i * m_parameters.step())) < ratioThreshold) {
-      /* We also round to 0 if start/(i*step) would have been rounded to -1.
-       * For example, with start=-1.2, and step=0.2, 6th element should be 0
-       * instead of 2.22e-16. */
-      m_intervalBuffer[i] = 0.0;
-    } else {
-      m_intervalBuffer[i] = PoincareHelpers::ValueOfFloatAsDisplayed<double>(m_parameters.start() + i * m_parameters.step(), precision, nullptr);
-      checkForElementZero = checkForElementZero && m_intervalBuffer[i] < 0.0;
-    }
+  /* We also round to 0 if start/(i*step) would have been rounded to -1.
+   * For example, with start=-1.2, and step=0.2, 6th element should be 0
+   * instead of 2.22e-16. */
+  if (m_parameters.start() < 0.0 && i > 0 && std::abs(1.0 + m_parameters.start() / (i * m_parameters.step())) < ratioThreshold) {
+    return 0.0;
   }
-  m_needCompute = false;
+  return PoincareHelpers::ValueOfFloatAsDisplayed<double>(m_parameters.start() + i * m_parameters.step(), precision, nullptr);
 }
 
 }
@@ -28,17 +28,32 @@ public:
   IntervalParameters * parameters() { return &m_parameters; }
   void setParameters(IntervalParameters parameters) { m_parameters = parameters; }
   void setElement(int i, double f);
+  // Only intervals that fit in the buffer can be edited
+  bool canBeEdited() { return numberOfElements() <= k_maxNumberOfEditableElements; }
   void forceRecompute(){ m_needCompute = true;}
   void reset();
   void clear();
   void translateTo(double newStart);
   bool isEmpty() const { return m_parameters.start() > m_parameters.end(); }
+  /* Elements are generated from the parameters when they are read, and are
+   * only copied in the buffer once the user edits them. Tables are scrolled
+   * with 16-bit offsets, which bounds the number of elements. */
+#ifdef SHARED_INTERVAL_MAX_NUMBER_OF_ELEMENTS
+  constexpr static int k_maxNumberOfElements = SHARED_INTERVAL_MAX_NUMBER_OF_ELEMENTS;
+#else
   constexpr static int k_maxNumberOfElements = 101;
+#endif
+  constexpr static int k_maxNumberOfEditableElements = 101;
+  static_assert(k_maxNumberOfEditableElements <= k_maxNumberOfElements && k_maxNumberOfElements <= 500, "SHARED_INTERVAL_MAX_NUMBER_OF_ELEMENTS should be in [101, 500]");
 private:
   void computeElements();
+  void materializeElements();
+  double computeElement(int i) const;
   int m_numberOfElements;
-  double m_intervalBuffer[k_maxNumberOfElements];
+  double m_intervalBuffer[k_maxNumberOfEditableElements];
   bool m_needCompute;
+  // The elements were edited and are stored in m_intervalBuffer
+  bool m_isMaterialized;
   IntervalParameters m_parameters;
 };
 
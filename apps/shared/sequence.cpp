@@ -170,6 +170,10 @@ template<typename T>
 T Sequence::templatedApproximateAtAbscissa(T x, SequenceContext * sqctx) const {
   T n = std::round(x);
   int sequenceIndex = SequenceStore::sequenceIndexForName(fullName()[0]);
+  T value;
+  if (sqctx->closedFormValueAtRank<T>(n, sequenceIndex, &value)) {
+    return value;
+  }
   if (sqctx->iterateUntilRank<T>(n)) {
     return sqctx->valueOfCommonRankSequenceAtPreviousRank<T>(sequenceIndex, 0);
   }
@@ -182,6 +186,10 @@ T Sequence::valueAtRank(int n, SequenceContext *sqctx) {
     return NAN;
   }
   int sequenceIndex = SequenceStore::sequenceIndexForName(fullName()[0]);
+  T value;
+  if (sqctx->closedFormValueAtRank<T>(n, sequenceIndex, &value)) {
+    return value;
+  }
   if (sqctx->independentSequenceRank<T>(sequenceIndex) > n || sqctx->independentSequenceRank<T>(sequenceIndex) < 0) {
     // Reset cache indexes and cache values
     sqctx->setIndependentSequenceRank<T>(-1, sequenceIndex);
@@ -194,8 +202,7 @@ T Sequence::valueAtRank(int n, SequenceContext *sqctx) {
   }
   /* In case we have sqctx->independentSequenceRank<T>(sequenceIndex) = n, we can return the
    * value */
-  T value = sqctx->independentSequenceValue<T>(sequenceIndex, 0);
-  return value;
+  return sqctx->independentSequenceValue<T>(sequenceIndex, 0);
 }
 
 template<typename T>
@@ -279,6 +286,111 @@ T Sequence::approximateToNextRank(int n, SequenceContext * sqctx, int sequenceIn
   }
 }
 
+static bool IsRecurrenceTerm(const Expression e, const char * name, bool acceptNextRank) {
+  assert(e.type() == ExpressionNode::Type::Sequence);
+  if (strcmp(static_cast<const Poincare::Sequence &>(e).name(), name) != 0) {
+    return false;
+  }
+  Expression rank = e.childAtIndex(0);
+  return rank.isIdenticalTo(Symbol::Builder(UCodePointUnknown))
+    || (acceptNextRank && rank.isIdenticalTo(Addition::Builder(Symbol::Builder(UCodePointUnknown), Rational::Builder(1))));
+}
+
+/* Replace the terms u(n) (and u(n+1)) of a recurrence with the unknown symbol,
+ * so that the degree of the recurrence can be read with polynomialDegree.
+ * Return false if the expression depends on n or on another sequence. */
+static bool ReplaceRecurrenceTermsWithUnknown(Expression e, const char * name, bool acceptNextRank) {
+  if (e.type() == ExpressionNode::Type::Symbol && static_cast<const Poincare::Symbol &>(e).isSystemSymbol()) {
+    return false;
+  }
+  int numberOfChildren = e.numberOfChildren();
+  for (int i = 0; i < numberOfChildren; i++) {
+    Expression child = e.childAtIndex(i);
+    if (child.type() == ExpressionNode::Type::Sequence) {
+      if (!IsRecurrenceTerm(child, name, acceptNextRank)) {
+        return false;
+      }
+      e.replaceChildAtIndexInPlace(i, Symbol::Builder(UCodePointUnknown));
+    } else if (!ReplaceRecurrenceTermsWithUnknown(child, name, acceptNextRank)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename T>
+bool Sequence::affineRecurrence(SequenceContext * sqctx, T coefficients[3], T initialValues[2]) {
+  Type sequenceType = type();
+  if (sequenceType == Type::Explicit) {
+    return false;
+  }
+  bool isDoubleRecurrence = sequenceType == Type::DoubleRecurrence;
+  constexpr size_t bufferSize = SequenceStore::k_maxSequenceNameLength + 1;
+  char buffer[bufferSize];
+  name(buffer, bufferSize);
+  Expression definition = expressionReduced(sqctx);
+  // A random term is drawn again at each rank
+  if (definition.recursivelyMatches(Expression::IsRandom, sqctx)) {
+    return false;
+  }
+  Expression recurrence = definition.clone();
+  if (recurrence.type() == ExpressionNode::Type::Sequence) {
+    if (!IsRecurrenceTerm(recurrence, buffer, isDoubleRecurrence)) {
+      return false;
+    }
+    recurrence = Symbol::Builder(UCodePointUnknown);
+  } else if (!ReplaceRecurrenceTermsWithUnknown(recurrence, buffer, isDoubleRecurrence)) {
+    return false;
+  }
+  int degree = recurrence.polynomialDegree(sqctx, k_unknownName);
+  if (degree < 0 || degree > 1) {
+    return false;
+  }
+
+  /* The recurrence being affine, its coefficients are read from its values.
+   * The previous terms are scaled like the constant to keep the precision. */
+  int sequenceIndex = SequenceStore::sequenceIndexForName(buffer[0]);
+  SequenceCacheContext<T> ctx = SequenceCacheContext<T>(sqctx, sequenceIndex);
+  Preferences preferences = Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(sqctx));
+  char termNames[SequenceStore::k_maxRecurrenceDepth][7] = {"0(n)","0(n+1)"};
+  Poincare::Symbol terms[SequenceStore::k_maxRecurrenceDepth];
+  for (int j = 0; j < SequenceStore::k_maxRecurrenceDepth; j++) {
+    termNames[j][0] = buffer[0];
+    terms[j] = Symbol::Builder(termNames[j], strlen(termNames[j]));
+  }
+  int numberOfTerms = isDoubleRecurrence ? 2 : 1;
+  T termValues[SequenceStore::k_maxRecurrenceDepth + 1];
+  for (int k = 0; k <= numberOfTerms; k++) {
+    for (int j = 0; j < SequenceStore::k_maxRecurrenceDepth; j++) {
+      ctx.setValueForSymbol(static_cast<T>(0.0), terms[j]);
+    }
+    T scale = 1.0;
+    if (k > 0) {
+      scale = std::max(static_cast<T>(1.0), std::fabs(termValues[0]));
+      ctx.setValueForSymbol(scale, terms[k - 1]);
+    }
+    termValues[k] = PoincareHelpers::ApproximateWithValueForSymbol(definition, k_unknownName, static_cast<T>(initialRank()), &ctx, &preferences, false);
+    if (!std::isfinite(termValues[k])) {
+      return false;
+    }
+    if (k > 0) {
+      termValues[k] = (termValues[k] - termValues[0]) / scale;
+    }
+  }
+  coefficients[0] = isDoubleRecurrence ? termValues[1] : static_cast<T>(0.0);
+  coefficients[1] = isDoubleRecurrence ? termValues[2] : termValues[1];
+  coefficients[2] = termValues[0];
+
+  SequenceCacheContext<T> initialConditionContext = SequenceCacheContext<T>(sqctx, sequenceIndex);
+  initialValues[0] = PoincareHelpers::ApproximateWithValueForSymbol(firstInitialConditionExpressionReduced(sqctx), k_unknownName, static_cast<T>(NAN), &initialConditionContext, &preferences, false);
+  if (isDoubleRecurrence) {
+    initialValues[1] = PoincareHelpers::ApproximateWithValueForSymbol(secondInitialConditionExpressionReduced(sqctx), k_unknownName, static_cast<T>(NAN), &initialConditionContext, &preferences, false);
+  } else {
+    initialValues[1] = coefficients[1] * initialValues[0] + coefficients[2];
+  }
+  return true;
+}
+
 Expression Sequence::sumBetweenBounds(double start, double end, Poincare::Context * context) const {
   /* Here, we cannot just create the expression sum(u(n), start, end) because
    * the approximation of u(n) is not handled by Poincare (but only by
@@ -403,5 +515,7 @@ template double Sequence::approximateToNextRank<double>(int, SequenceContext*, i
 template float Sequence::approximateToNextRank<float>(int, SequenceContext*, int) const;
 template double Sequence::valueAtRank<double>(int, SequenceContext *);
 template float Sequence::valueAtRank<float>(int, SequenceContext *);
+template bool Sequence::affineRecurrence<double>(SequenceContext *, double[3], double[2]);
+template bool Sequence::affineRecurrence<float>(SequenceContext *, float[3], float[2]);
 
 }
@@ -71,6 +71,13 @@ public:
     return Poincare::Coordinate2D<double>(x,templatedApproximateAtAbscissa(x, reinterpret_cast<SequenceContext *>(context)));
   }
   template<typename T> T approximateToNextRank(int n, SequenceContext * sqctx, int sequenceIndex = -1) const;
+  /* affineRecurrence returns true if the sequence is recurrent and the next
+   * term is an affine combination of the previous ones, with coefficients that
+   * do not depend on n nor on other sequences. It then fills coefficients with
+   * a, b and c such that u(n+2) = a*u(n)+b*u(n+1)+c for n >= r, and
+   * initialValues with u(r) and u(r+1), where r is the initial rank. A single
+   * recurrence u(n+1) = b*u(n)+c is given a = 0. */
+  template<typename T> bool affineRecurrence(SequenceContext * sqctx, T coefficients[3], T initialValues[2]);
   template<typename T> T valueAtRank(int n, SequenceContext * sqctx);
 
   Poincare::Expression sumBetweenBounds(double start, double end, Poincare::Context * context) const override;
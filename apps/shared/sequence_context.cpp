@@ -1,8 +1,10 @@
 #include "sequence_context.h"
 #include "sequence_store.h"
 #include "sequence_cache_context.h"
+#include "sequence.h"
 #include "../shared/poincare_helpers.h"
 #include <cmath>
+#include <string.h>
 
 using namespace Poincare;
 
@@ -12,6 +14,10 @@ template<typename T>
 TemplatedSequenceContext<T>::TemplatedSequenceContext() :
   m_commonRank(-1),
   m_commonRankValues{{NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}},
+#if SHARED_SEQUENCE_RANK_CHECKPOINTS
+  m_numberOfRankCheckpoints(0),
+#endif
+  m_recurrenceForms{RecurrenceForm::Unknown, RecurrenceForm::Unknown, RecurrenceForm::Unknown},
   m_independentRanks{-1, -1, -1},
   m_independentRankValues{{NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}}
 {
@@ -29,14 +35,18 @@ void TemplatedSequenceContext<T>::resetCache() {
    * values stored in m_commomValues and m_independentRankValues are dirty
    * and do not use them. */
   m_commonRank = -1;
+#if SHARED_SEQUENCE_RANK_CHECKPOINTS
+  m_numberOfRankCheckpoints = 0;
+#endif
   for (int i = 0; i < SequenceStore::k_maxNumberOfSequences; i ++) {
     m_independentRanks[i] = -1;
+    m_recurrenceForms[i] = RecurrenceForm::Unknown;
   }
 }
 
 template<typename T>
 bool TemplatedSequenceContext<T>::iterateUntilRank(int n, SequenceStore * sequenceStore, SequenceContext * sqctx) {
-  if (m_commonRank > n) {
+  if (m_commonRank > n && !restoreRankCheckpoint(n)) {
     m_commonRank = -1;
   }
   if (n < 0 || n-m_commonRank > k_maxRecurrentRank) {
@@ -44,6 +54,110 @@ bool TemplatedSequenceContext<T>::iterateUntilRank(int n, SequenceStore * sequen
   }
   while (m_commonRank < n) {
     step(sqctx);
+    saveRankCheckpoint();
+  }
+  return true;
+}
+
+#if SHARED_SEQUENCE_RANK_CHECKPOINTS
+template<typename T>
+void TemplatedSequenceContext<T>::saveRankCheckpoint() {
+  /* Ranks are stepped one by one from the initial rank or from a checkpoint,
+   * so the checkpoints are always saved in order. */
+  if (m_commonRank % k_rankCheckpointInterval != 0) {
+    return;
+  }
+  int checkpointIndex = m_commonRank / k_rankCheckpointInterval;
+  if (checkpointIndex > m_numberOfRankCheckpoints || checkpointIndex >= k_numberOfRankCheckpoints) {
+    return;
+  }
+  memcpy(m_rankCheckpointValues[checkpointIndex], m_commonRankValues, sizeof(m_commonRankValues));
+  if (checkpointIndex == m_numberOfRankCheckpoints) {
+    m_numberOfRankCheckpoints++;
+  }
+}
+
+template<typename T>
+bool TemplatedSequenceContext<T>::restoreRankCheckpoint(int rank) {
+  int checkpointIndex = rank / k_rankCheckpointInterval;
+  if (rank < 0 || checkpointIndex >= m_numberOfRankCheckpoints) {
+    return false;
+  }
+  m_commonRank = checkpointIndex * k_rankCheckpointInterval;
+  memcpy(m_commonRankValues, m_rankCheckpointValues[checkpointIndex], sizeof(m_commonRankValues));
+  return true;
+}
+#endif
+
+// Product of 3x3 matrices, result can alias neither a nor b
+template<typename T>
+static void MultiplyMatrices(const T a[3][3], const T b[3][3], T result[3][3]) {
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      result[i][j] = 0;
+      for (int k = 0; k < 3; k++) {
+        result[i][j] += a[i][k] * b[k][j];
+      }
+    }
+  }
+}
+
+template<typename T>
+bool TemplatedSequenceContext<T>::closedFormValueAtRank(T rank, int sequenceIndex, SequenceContext * sqctx, T * value) {
+  if (m_recurrenceForms[sequenceIndex] == RecurrenceForm::Unknown) {
+    m_recurrenceForms[sequenceIndex] = RecurrenceForm::General;
+    Ion::Storage::Record record = sqctx->sequenceStore()->recordAtNameIndex(sequenceIndex);
+    if (!record.isNull()) {
+      Sequence * u = sqctx->sequenceStore()->modelForRecord(record);
+      if (u->isDefined() && u->template affineRecurrence<T>(sqctx, m_affineCoefficients[sequenceIndex], m_affineInitialValues[sequenceIndex])) {
+        m_recurrenceForms[sequenceIndex] = RecurrenceForm::Affine;
+        m_affineInitialRanks[sequenceIndex] = u->initialRank();
+      }
+    }
+  }
+  if (m_recurrenceForms[sequenceIndex] != RecurrenceForm::Affine || !(std::fabs(rank) < k_maxClosedFormRank)) {
+    return false;
+  }
+  int k = static_cast<int>(rank) - m_affineInitialRanks[sequenceIndex];
+  const T * u = m_affineInitialValues[sequenceIndex];
+  T a = m_affineCoefficients[sequenceIndex][0];
+  T b = m_affineCoefficients[sequenceIndex][1];
+  T c = m_affineCoefficients[sequenceIndex][2];
+  if (k < 0) {
+    *value = NAN;
+  } else if (k < SequenceStore::k_maxRecurrenceDepth) {
+    *value = u[k];
+  } else if (a == 0 && b == 1) {
+    // Arithmetic sequence
+    *value = u[1] + static_cast<T>(k - 1) * c;
+  } else if (a == 0 && c == 0) {
+    // Geometric sequence
+    *value = u[1] * std::pow(b, static_cast<T>(k - 1));
+  } else {
+    /* (u(n+1), u(n+2), 1) = M * (u(n), u(n+1), 1), so u(r+k) is the first
+     * coordinate of M^k * (u(r), u(r+1), 1), computed by squaring. */
+    T power[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    T square[3][3] = {{0, 1, 0}, {a, b, c}, {0, 0, 1}};
+    T product[3][3];
+    int exponent = k;
+    while (exponent > 0) {
+      if (exponent & 1) {
+        MultiplyMatrices<T>(power, square, product);
+        memcpy(power, product, sizeof(power));
+      }
+      exponent >>= 1;
+      if (exponent > 0) {
+        MultiplyMatrices<T>(square, square, product);
+        memcpy(square, product, sizeof(square));
+      }
+    }
+    *value = power[0][2];
+    for (int j = 0; j < SequenceStore::k_maxRecurrenceDepth; j++) {
+      // Skip null coefficients so that an unused undefined term is ignored
+      if (power[0][j] != 0) {
+        *value += power[0][j] * u[j];
+      }
+    }
   }
   return true;
 }
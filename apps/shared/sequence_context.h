@@ -23,8 +23,33 @@ public:
   T independentSequenceValue(int sequenceIndex, int depth) { return m_independentRankValues[sequenceIndex][depth]; }
   void setIndependentSequenceValue(T value, int sequenceIndex, int depth) { m_independentRankValues[sequenceIndex][depth] = value; }
   void step(SequenceContext * sqctx, int sequenceIndex = -1);
+  /* Affine recurrences are evaluated at any rank with a closed form or with a
+   * power of their companion matrix, without stepping through the ranks.
+   * closedFormValueAtRank returns false for other sequences. */
+  bool closedFormValueAtRank(T rank, int sequenceIndex, SequenceContext * sqctx, T * value);
 private:
   constexpr static int k_maxRecurrentRank = 10000;
+  constexpr static int k_maxClosedFormRank = 1000000000;
+#if SHARED_SEQUENCE_RANK_CHECKPOINTS
+  /* The common rank values are saved every k_rankCheckpointInterval ranks, so
+   * that going back to a previous rank resumes from the closest checkpoint
+   * instead of the initial rank. The checkpoints take too much RAM for the
+   * device, which steps again from the initial rank. */
+  constexpr static int k_rankCheckpointInterval = 256;
+  constexpr static int k_numberOfRankCheckpoints = k_maxRecurrentRank / k_rankCheckpointInterval + 1;
+#endif
+  enum class RecurrenceForm : uint8_t {
+    Unknown,
+    General,
+    Affine
+  };
+#if SHARED_SEQUENCE_RANK_CHECKPOINTS
+  void saveRankCheckpoint();
+  bool restoreRankCheckpoint(int rank);
+#else
+  void saveRankCheckpoint() {}
+  bool restoreRankCheckpoint(int) { return false; }
+#endif
   /* Cache:
    * We use two types of cache :
    * The first one is used to to accelerate the
@@ -44,6 +69,16 @@ private:
    */
   int m_commonRank;
   T m_commonRankValues[SequenceStore::k_maxNumberOfSequences][SequenceStore::k_maxRecurrenceDepth+1];
+#if SHARED_SEQUENCE_RANK_CHECKPOINTS
+  int m_numberOfRankCheckpoints;
+  T m_rankCheckpointValues[k_numberOfRankCheckpoints][SequenceStore::k_maxNumberOfSequences][SequenceStore::k_maxRecurrenceDepth+1];
+#endif
+
+  // Coefficients of affine recurrences, see Sequence::affineRecurrence
+  RecurrenceForm m_recurrenceForms[SequenceStore::k_maxNumberOfSequences];
+  int m_affineInitialRanks[SequenceStore::k_maxNumberOfSequences];
+  T m_affineCoefficients[SequenceStore::k_maxNumberOfSequences][SequenceStore::k_maxRecurrenceDepth+1];
+  T m_affineInitialValues[SequenceStore::k_maxNumberOfSequences][SequenceStore::k_maxRecurrenceDepth];
 
   // Used for fixed computations
   int m_independentRanks[SequenceStore::k_maxNumberOfSequences];
@@ -76,6 +111,10 @@ public:
     return static_cast<TemplatedSequenceContext<T>*>(helper<T>())->iterateUntilRank(n, m_sequenceStore, this);
   }
 
+  template<typename T> bool closedFormValueAtRank(T rank, int sequenceIndex, T * value) {
+    return static_cast<TemplatedSequenceContext<T>*>(helper<T>())->closedFormValueAtRank(rank, sequenceIndex, this, value);
+  }
+
   template<typename T> int independentSequenceRank(int sequenceIndex) {
     return static_cast<TemplatedSequenceContext<T>*>(helper<T>())->independentSequenceRank(sequenceIndex);
   }
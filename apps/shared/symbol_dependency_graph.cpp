@@ -0,0 +1,154 @@
+#include "symbol_dependency_graph.h"
+#include "continuous_function.h"
+#include "global_context.h"
+#include "sequence.h"
+#include <ion/storage/file_system.h>
+#include <poincare/symbol.h>
+#include <assert.h>
+#include <string.h>
+
+using namespace Poincare;
+
+namespace Shared {
+
+#if SHARED_SYMBOL_DEPENDENCY_GRAPH
+
+SymbolDependencyGraph::Version SymbolDependencyGraph::versionOfRecord(Ion::Storage::Record record) {
+  Ion::Storage::Record::Name name = record.name();
+  if (Ion::Storage::Record::NameIsEmpty(name)) {
+    return ++m_version;
+  }
+  return versionOfBaseName(name.baseName, name.baseNameLength);
+}
+
+SymbolDependencyGraph::Version SymbolDependencyGraph::versionOfBaseName(const char * baseName, size_t baseNameLength) {
+  int index = indexOfNode(baseName, baseNameLength);
+  if (index < 0) {
+    if (m_numberOfNodes == k_maxNumberOfNodes) {
+      m_numberOfNodes = 0;
+    }
+    index = addNode(baseName, baseNameLength);
+    if (index < 0) {
+      // The name is too long to be a symbol
+      return ++m_version;
+    }
+  }
+  return m_nodes[index].version;
+}
+
+void SymbolDependencyGraph::storageDidChangeForRecord(Ion::Storage::Record record) {
+  uint32_t changedNodes = 0;
+  bool untrackedRecordChanged = record.isNull();
+  if (!untrackedRecordChanged) {
+    Ion::Storage::Record::Name name = record.name();
+    int index = Ion::Storage::Record::NameIsEmpty(name) ? -1 : indexOfNode(name.baseName, name.baseNameLength);
+    if (index < 0) {
+      untrackedRecordChanged = true;
+    } else if (updateNode(index)) {
+      changedNodes |= 1u << index;
+    }
+  }
+  /* Destroyed records are notified with a null record and renamed records
+   * with their new name only, so the records of all nodes are checked. */
+  for (int i = 0; i < m_numberOfNodes; i++) {
+    Node * node = m_nodes + i;
+    if ((!node->record.isNull() && !Ion::Storage::FileSystem::sharedFileSystem()->hasRecord(node->record) && updateNode(i))
+        || (untrackedRecordChanged && node->dependsOnUntrackedNodes)) {
+      changedNodes |= 1u << i;
+    }
+  }
+  propagateChanges(changedNodes);
+}
+
+int SymbolDependencyGraph::indexOfNode(const char * name, size_t length) const {
+  for (int i = 0; i < m_numberOfNodes; i++) {
+    if (strncmp(m_nodes[i].name, name, length) == 0 && m_nodes[i].name[length] == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int SymbolDependencyGraph::addNode(const char * name, size_t length) {
+  if (m_numberOfNodes == k_maxNumberOfNodes || length >= SymbolAbstract::k_maxNameSize) {
+    return -1;
+  }
+  int index = m_numberOfNodes++;
+  Node * node = m_nodes + index;
+  memcpy(node->name, name, length);
+  node->name[length] = 0;
+  node->version = ++m_version;
+  updateNode(index, true);
+  return index;
+}
+
+bool SymbolDependencyGraph::updateNode(int index, bool force) {
+  Node * node = m_nodes + index;
+  Ion::Storage::Record record = Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtensions(node->name, GlobalContext::k_extensions, GlobalContext::k_numberOfExtensions);
+  uint32_t checksum = record.isNull() ? 0 : record.checksum();
+  if (!force && record == node->record && checksum == node->checksum) {
+    return false;
+  }
+  node->record = record;
+  node->checksum = checksum;
+  node->dependencies = 0;
+  node->dependsOnUntrackedNodes = false;
+  if (record.hasExtension(Ion::Storage::funcExtension)) {
+    addDependencies(index, ContinuousFunction(record).expressionClone());
+  } else if (record.hasExtension(Ion::Storage::seqExtension)) {
+    Sequence sequence(record);
+    addDependencies(index, sequence.expressionClone());
+    addDependencies(index, sequence.firstInitialConditionExpressionClone());
+    addDependencies(index, sequence.secondInitialConditionExpressionClone());
+  }
+  return true;
+}
+
+void SymbolDependencyGraph::addDependencies(int index, const Expression e) {
+  if (e.isUninitialized()) {
+    return;
+  }
+  if (e.isOfType({ExpressionNode::Type::Symbol, ExpressionNode::Type::Function, ExpressionNode::Type::Sequence})
+      && !(e.type() == ExpressionNode::Type::Symbol && static_cast<const Symbol &>(e).isSystemSymbol())) {
+    const char * name = static_cast<const SymbolAbstract &>(e).name();
+    size_t length = strlen(name);
+    int dependencyIndex = indexOfNode(name, length);
+    if (dependencyIndex < 0) {
+      dependencyIndex = addNode(name, length);
+    }
+    if (dependencyIndex < 0) {
+      m_nodes[index].dependsOnUntrackedNodes = true;
+    } else if (dependencyIndex != index) {
+      m_nodes[index].dependencies |= 1u << dependencyIndex;
+    }
+  }
+  int n = e.numberOfChildren();
+  for (int i = 0; i < n; i++) {
+    addDependencies(index, e.childAtIndex(i));
+  }
+}
+
+void SymbolDependencyGraph::propagateChanges(uint32_t changedNodes) {
+  if (changedNodes == 0) {
+    return;
+  }
+  uint32_t previousChangedNodes;
+  do {
+    previousChangedNodes = changedNodes;
+    for (int i = 0; i < m_numberOfNodes; i++) {
+      if (m_nodes[i].dependencies & changedNodes) {
+        changedNodes |= 1u << i;
+      }
+    }
+  } while (changedNodes != previousChangedNodes);
+  m_version++;
+  for (int i = 0; i < m_numberOfNodes; i++) {
+    if (changedNodes & (1u << i)) {
+      m_nodes[i].version = m_version;
+    }
+  }
+}
+
+#endif
+
+}
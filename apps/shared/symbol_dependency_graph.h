@@ -0,0 +1,80 @@
+#ifndef SHARED_SYMBOL_DEPENDENCY_GRAPH_H
+#define SHARED_SYMBOL_DEPENDENCY_GRAPH_H
+
+#include <ion/storage/record.h>
+#include <poincare/expression.h>
+#include <poincare/symbol_abstract.h>
+#include <stdint.h>
+
+namespace Shared {
+
+/* SymbolDependencyGraph tracks which stored symbols, lists, functions and
+ * sequences depend on which others. Each node is a base name, defined by a
+ * record or not yet, and its edges are read from the definition of the
+ * function or sequence it names. Symbols and lists are stored simplified, so
+ * they have no dependencies.
+ * When the content of a record changes, the node and all the nodes depending
+ * on it get a new version. Asking whether anything a record depends on changed
+ * is then a single comparison with the version seen last time.
+ * Only the queried records and their dependencies are tracked. When the graph
+ * is full, it is emptied and the next versions are new to everyone. */
+
+class SymbolDependencyGraph {
+public:
+  typedef uint32_t Version;
+#if SHARED_SYMBOL_DEPENDENCY_GRAPH
+  constexpr static int k_maxNumberOfNodes = 32;
+
+  SymbolDependencyGraph() : m_numberOfNodes(0), m_version(0) {}
+#else
+  SymbolDependencyGraph() : m_version(0) {}
+#endif
+
+  Version currentVersion() const { return m_version; }
+#if SHARED_SYMBOL_DEPENDENCY_GRAPH
+  /* Version of the last change of the record or of a record it depends on.
+   * A record that was not tracked yet gets a new version. */
+  Version versionOfRecord(Ion::Storage::Record record);
+  Version versionOfBaseName(const char * baseName, size_t baseNameLength);
+
+  // A null record means that records may have been destroyed
+  void storageDidChangeForRecord(Ion::Storage::Record record);
+#else
+  /* The nodes take about 1KB, which the device RAM cannot spare. Without them,
+   * any change of the storage is a change of every record. */
+  Version versionOfRecord(Ion::Storage::Record record) { return m_version; }
+  Version versionOfBaseName(const char * baseName, size_t baseNameLength) { return m_version; }
+  void storageDidChangeForRecord(Ion::Storage::Record record) { m_version++; }
+#endif
+
+private:
+#if SHARED_SYMBOL_DEPENDENCY_GRAPH
+  struct Node {
+    char name[Poincare::SymbolAbstract::k_maxNameSize];
+    Ion::Storage::Record record;
+    uint32_t checksum;
+    // Bit i is set if the node depends on the i-th node
+    uint32_t dependencies;
+    Version version;
+    // Some dependencies could not be tracked because the graph was full
+    bool dependsOnUntrackedNodes;
+  };
+  static_assert(k_maxNumberOfNodes <= 32, "Node dependencies do not fit in a uint32_t");
+
+  int indexOfNode(const char * name, size_t length) const;
+  // Return -1 if the graph is full or if the name cannot be a symbol
+  int addNode(const char * name, size_t length);
+  // Read the record of the node, return true if its content changed
+  bool updateNode(int index, bool force = false);
+  void addDependencies(int index, const Poincare::Expression e);
+  void propagateChanges(uint32_t changedNodes);
+
+  Node m_nodes[k_maxNumberOfNodes];
+  int m_numberOfNodes;
+#endif
+  Version m_version;
+};
+
+}
+
+#endif
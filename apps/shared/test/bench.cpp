@@ -0,0 +1,40 @@
+#include <quiz.h>
+#include <apps/shared/curve_view_range.h>
+#include <apps/shared/plot_view_policies.h>
+#include <kandinsky/ion_context.h>
+#include <cmath>
+
+using namespace Shared;
+using namespace Poincare;
+
+class BenchRange : public CurveViewRange {
+public:
+  float xMin() const override { return -10.0f; }
+  float xMax() const override { return 10.0f; }
+  float yMin() const override { return -3.0f; }
+  float yMax() const override { return 3.0f; }
+};
+
+class BenchCurvePolicy : public PlotPolicy::WithCurves {
+protected:
+  void drawPlot(const AbstractPlotView * plotView, KDContext * ctx, KDRect rect) const {
+    Curve2DEvaluation<float> evaluation = [](float t, void *, void *) {
+      return Coordinate2D<float>(t, std::sin(3.0f * t) + 0.5f * std::cos(7.0f * t));
+    };
+    CurveDrawing plot(Curve2D(evaluation), nullptr, plotView->rangeMin(AbstractPlotView::Axis::Horizontal), plotView->rangeMax(AbstractPlotView::Axis::Horizontal), plotView->pixelWidth(), KDColorRed);
+    plot.draw(plotView, ctx, rect);
+  }
+};
+
+class BenchPlotView : public PlotView<PlotPolicy::Axes<PlotPolicy::NoGrid, PlotPolicy::NoAxis, PlotPolicy::NoAxis>, BenchCurvePolicy, PlotPolicy::NoBanner, PlotPolicy::NoCursor> {
+public:
+  using PlotView::PlotView;
+};
+
+QUIZ_BENCH(shared_curve_drawing_draw) {
+  BenchRange range;
+  BenchPlotView plotView(&range);
+  KDRect frame(0, 0, Ion::Display::Width, Ion::Display::Height);
+  plotView.setFrame(frame, false);
+  plotView.drawRect(KDIonContext::SharedContext(), frame);
+}
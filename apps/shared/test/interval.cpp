@@ -27,4 +27,27 @@ QUIZ_CASE(interval_values) {
   }
 }
 
-}
\ No newline at end of file
+QUIZ_CASE(interval_generated_elements) {
+  Interval interval;
+  Interval::IntervalParameters * params = interval.parameters();
+  params->setStart(0.0);
+  params->setEnd(1e6);
+  params->setStep(1.0);
+  interval.forceRecompute();
+  quiz_assert(interval.numberOfElements() == Interval::k_maxNumberOfElements);
+  quiz_assert(interval.element(Interval::k_maxNumberOfElements - 1) == Interval::k_maxNumberOfElements - 1);
+  quiz_assert(interval.canBeEdited() == (Interval::k_maxNumberOfElements <= Interval::k_maxNumberOfEditableElements));
+
+  // Edited elements are kept until the parameters change
+  params->setEnd(9.0);
+  interval.forceRecompute();
+  interval.setElement(3, 0.5);
+  interval.deleteElementAtIndex(0);
+  quiz_assert(interval.numberOfElements() == 9);
+  quiz_assert(interval.element(2) == 0.5 && interval.element(3) == 4.0);
+  interval.forceRecompute();
+  quiz_assert(interval.numberOfElements() == 10);
+  quiz_assert(interval.element(2) == 2.0 && interval.element(3) == 3.0);
+}
+
+}
@@ -0,0 +1,86 @@
+#include <quiz.h>
+#include "../continuous_function_store.h"
+#include "../global_context.h"
+#include "../symbol_dependency_graph.h"
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
+
+using namespace Poincare;
+
+namespace Shared {
+
+void addFunction(const char * definition, ContinuousFunctionStore * store, Context * context) {
+  quiz_assert(store->addEmptyModel() == Ion::Storage::Record::ErrorStatus::None);
+  Ion::Storage::Record record = store->recordAtIndex(store->numberOfModels() - 1);
+  quiz_assert(store->modelForRecord(record)->setContent(definition, context) == Ion::Storage::Record::ErrorStatus::None);
+}
+
+QUIZ_CASE(symbol_dependency_graph) {
+  GlobalContext context;
+  ContinuousFunctionStore store;
+  SymbolDependencyGraph graph;
+  Symbol a = Symbol::Builder("a", 1);
+  Symbol b = Symbol::Builder("b", 1);
+  context.setExpressionForSymbolAbstract(Rational::Builder(2), a);
+  context.setExpressionForSymbolAbstract(Rational::Builder(3), b);
+  addFunction("f(x)=a*x", &store, &context);
+  addFunction("g(x)=f(x)+1", &store, &context);
+  addFunction("h(x)=b*x", &store, &context);
+
+  SymbolDependencyGraph::Version f = graph.versionOfBaseName("f", 1);
+  SymbolDependencyGraph::Version g = graph.versionOfBaseName("g", 1);
+  SymbolDependencyGraph::Version h = graph.versionOfBaseName("h", 1);
+  quiz_assert(graph.versionOfBaseName("f", 1) == f);
+
+  // Changing a changes the functions using it, directly or not
+  context.setExpressionForSymbolAbstract(Rational::Builder(5), a);
+  graph.storageDidChangeForRecord(Ion::Storage::Record("a.exp"));
+  quiz_assert(graph.versionOfBaseName("f", 1) != f);
+  quiz_assert(graph.versionOfBaseName("g", 1) != g);
+  quiz_assert(graph.versionOfBaseName("h", 1) == h);
+
+  // Storing the same value again does not change anything
+  f = graph.versionOfBaseName("f", 1);
+  context.setExpressionForSymbolAbstract(Rational::Builder(5), a);
+  graph.storageDidChangeForRecord(Ion::Storage::Record("a.exp"));
+  quiz_assert(graph.versionOfBaseName("f", 1) == f);
+
+  // The store only resets the models depending on the changed record
+  for (const char * name : {"f", "g", "h"}) {
+    store.modelForRecord(Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtension(name, Ion::Storage::funcExtension))->setCache(store.cacheAtIndex(0));
+  }
+  SymbolDependencyGraph::Version previousVersion = graph.currentVersion();
+  context.setExpressionForSymbolAbstract(Rational::Builder(7), a);
+  graph.storageDidChangeForRecord(Ion::Storage::Record("a.exp"));
+  store.storageDidChangeForRecord(Ion::Storage::Record("a.exp"), &graph, previousVersion);
+  quiz_assert(store.modelForRecord(Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtension("h", Ion::Storage::funcExtension))->cache() != nullptr);
+  quiz_assert(store.modelForRecord(Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtension("f", Ion::Storage::funcExtension))->cache() == nullptr);
+  quiz_assert(store.modelForRecord(Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtension("g", Ion::Storage::funcExtension))->cache() == nullptr);
+  f = graph.versionOfBaseName("f", 1);
+
+  // Destroyed records are notified with a null record
+  Ion::Storage::Record("b.exp").destroy();
+  graph.storageDidChangeForRecord(Ion::Storage::Record());
+  quiz_assert(graph.versionOfBaseName("f", 1) == f);
+  quiz_assert(graph.versionOfBaseName("h", 1) != h);
+
+  store.removeAll();
+  Ion::Storage::Record("a.exp").destroy();
+}
+
+QUIZ_CASE(symbol_dependency_graph_is_emptied_when_full) {
+  SymbolDependencyGraph graph;
+  char name[] = "n00";
+  SymbolDependencyGraph::Version first = graph.versionOfBaseName(name, 3);
+  for (int i = 1; i < SymbolDependencyGraph::k_maxNumberOfNodes; i++) {
+    name[1] = '0' + i / 10;
+    name[2] = '0' + i % 10;
+    graph.versionOfBaseName(name, 3);
+  }
+  quiz_assert(graph.versionOfBaseName("n00", 3) == first);
+  // A new node empties the full graph, the nodes are then new
+  graph.versionOfBaseName("n99", 3);
+  quiz_assert(graph.versionOfBaseName("n00", 3) > first);
+}
+
+}
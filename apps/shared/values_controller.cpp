@@ -4,7 +4,6 @@
 #include <poincare/empty_layout.h>
 #include <poincare/preferences.h>
 #include <assert.h>
-#include <limits.h>
 #include <algorithm>
 #include <stdlib.h>
 
@@ -21,10 +20,13 @@ ValuesController::ValuesController(Responder * parentResponder, ButtonRowControl
   m_numberOfColumns(0),
   m_numberOfColumnsNeedUpdate(true),
   m_prefacedTwiceTableView(0, 0, this, &m_selectableTableView, this),
-  m_firstMemoizedColumn(INT_MAX),
-  m_firstMemoizedRow(INT_MAX),
+  m_lastMemoizedRow(0),
   m_abscissaParameterController(this, this)
 {
+  for (int i = 0; i < k_numberOfMemoizedRows * k_maxNumberOfMemoizedColumns; i++) {
+    m_memoizedColumns[i] = -1;
+    m_memoizedRows[i] = -1;
+  }
   m_prefacedTwiceTableView.setBackgroundColor(Palette::WallScreenDark);
   m_prefacedTwiceTableView.setCellOverlap(0, 0);
   m_prefacedTwiceTableView.setMargins(k_margin, k_scrollBarMargin, k_scrollBarMargin, k_margin);
@@ -84,7 +86,8 @@ bool ValuesController::handleEvent(Ion::Events::Event event) {
     return true;
   }
   if (event == Ion::Events::Backspace && selectedRow() > 0 &&
-    selectedRow() <= numberOfElementsInColumn(selectedColumn())) {
+    selectedRow() <= numberOfElementsInColumn(selectedColumn()) &&
+    intervalAtColumn(selectedColumn())->canBeEdited()) {
     int row = selectedRow();
     int column = selectedColumn();
     intervalAtColumn(column)->deleteElementAtIndex(row - k_numberOfTitleRows);
@@ -213,6 +216,10 @@ ColumnParameters * ValuesController::columnParameters() {
   return functionParameters();
 }
 
+bool ValuesController::checkDataAtLocation(double floatBody, int columnIndex, int rowIndex) const {
+  return const_cast<ValuesController *>(this)->intervalAtColumn(columnIndex)->canBeEdited();
+}
+
 bool ValuesController::setDataAtLocation(double floatBody, int columnIndex, int rowIndex) {
   assert(checkDataAtLocation(floatBody, columnIndex, rowIndex));
   intervalAtColumn(columnIndex)->setElement(rowIndex - k_numberOfTitleRows, floatBody);
@@ -256,11 +263,7 @@ void ValuesController::didChangeCell(int column, int row) {
   // the first row is never reloaded as it corresponds to title row
   assert(row > 0);
   // Conversion of coordinates from absolute table to values table
-  int memoizedRow = valuesRowForAbsoluteRow(row) - m_firstMemoizedRow;
-  if (0 > memoizedRow || memoizedRow >= k_maxNumberOfDisplayableRows) {
-    // The changed row is out of the memoized table
-    return;
-  }
+  int valuesRow = valuesRowForAbsoluteRow(row);
 
   // Find the abscissa column corresponding to column
   int abscissaColumn = 0;
@@ -271,16 +274,14 @@ void ValuesController::didChangeCell(int column, int row) {
   }
 
   // Update the memoization of rows linked to the changed cell
-  int nbOfMemoizedColumns = maxNumberOfDisplayableFunctions();
   int nbOfColumnsForAbscissa = numberOfColumnsForAbscissaColumn(abscissaColumn);
   for (int i = abscissaColumn+1; i < abscissaColumn+nbOfColumnsForAbscissa; i++) {
-    int memoizedI = valuesColumnForAbsoluteColumn(i) - m_firstMemoizedColumn;
-    if (memoizedI < 0 || memoizedI >= nbOfMemoizedColumns) {
-      // The changed column is out of the memoized table
+    if (!isMemoized(valuesColumnForAbsoluteColumn(i), valuesRow)) {
+      // The changed cell is out of the memoized table
       continue;
     }
     KDCoordinate currentWidth = columnWidth(i);
-    createMemoizedLayout(i, row, nbOfMemoizedColumns*memoizedRow+memoizedI);
+    createMemoizedLayoutAtValuesCell(valuesColumnForAbsoluteColumn(i), valuesRow);
     updateSizeMemoizationForColumnAfterIndexChanged(i, currentWidth, row);
   }
 }
@@ -313,9 +314,11 @@ FunctionStore * ValuesController::functionStore() const {
 // Function evaluation memoization
 
 void ValuesController::resetLayoutMemoization() {
-  const int numberOfMemoizedCell = k_maxNumberOfDisplayableRows * maxNumberOfDisplayableFunctions();
+  const int numberOfMemoizedCell = k_numberOfMemoizedRows * maxNumberOfDisplayableFunctions();
   for (int i = 0; i < numberOfMemoizedCell; i++) {
     *memoizedLayoutAtIndex(i) = Layout();
+    m_memoizedColumns[i] = -1;
+    m_memoizedRows[i] = -1;
   }
   const int numberOfValueCells = maxNumberOfCells();
   for (int i = 0; i < numberOfValueCells; i++) {
@@ -331,63 +334,48 @@ void ValuesController::resetLayoutMemoization() {
   }
   resetMemoization(); // reset sizes memoization
   m_prefacedTwiceTableView.resetDataSourceSizeMemoization();
-  m_firstMemoizedColumn = INT_MAX;
-  m_firstMemoizedRow = INT_MAX;
+  m_lastMemoizedRow = 0;
 }
 
 Layout ValuesController::memoizedLayoutForCell(int i, int j) {
-  const int nbOfMemoizedColumns = maxNumberOfDisplayableFunctions();
+  assert(maxNumberOfDisplayableFunctions() <= k_maxNumberOfMemoizedColumns);
   // Conversion of coordinates from absolute table to values table
   int valuesI = valuesColumnForAbsoluteColumn(i);
   int valuesJ = valuesRowForAbsoluteRow(j);
-  /* Compute the required offset to apply to the memoized table in order to
-   * display cell (i,j) */
-  int offsetI = 0;
-  int offsetJ = 0;
-  if (valuesI < m_firstMemoizedColumn) {
-    offsetI = valuesI - m_firstMemoizedColumn;
-  } else if (valuesI >= m_firstMemoizedColumn + nbOfMemoizedColumns) {
-    offsetI = valuesI - nbOfMemoizedColumns - m_firstMemoizedColumn + 1;
-  }
-  if (valuesJ < m_firstMemoizedRow) {
-    offsetJ = valuesJ - m_firstMemoizedRow;
-  } else if (valuesJ >= m_firstMemoizedRow + k_maxNumberOfDisplayableRows) {
-    offsetJ = valuesJ - k_maxNumberOfDisplayableRows - m_firstMemoizedRow + 1;
-  }
-  int offset = -offsetJ*nbOfMemoizedColumns-offsetI;
-
-  // Apply the offset
-  if (offset != 0) {
-    m_firstMemoizedColumn = m_firstMemoizedColumn + offsetI;
-    m_firstMemoizedRow = m_firstMemoizedRow + offsetJ;
-    // Shift already memoized cells
-    const int numberOfMemoizedCell = k_maxNumberOfDisplayableRows * nbOfMemoizedColumns;
-    const int numberOfLayoutsToMove = numberOfMemoizedCell - abs(offset);
-    if (offset > 0 && offset < numberOfMemoizedCell) {
-      for (int i = numberOfLayoutsToMove - 1; i >= 0; i--) {
-        *memoizedLayoutAtIndex(offset + i) = *memoizedLayoutAtIndex(i);
-      }
-    } else if (offset < 0 && offset > -numberOfMemoizedCell) {
-      for (int i = - offset ; i < - offset + numberOfLayoutsToMove; i++) {
-        *memoizedLayoutAtIndex(offset + i) = *memoizedLayoutAtIndex(i);
+  if (!isMemoized(valuesI, valuesJ)) {
+    /* Evaluate the next cells of the column in the scroll direction too, so
+     * that they are ready when they are scrolled to. */
+    int direction = valuesJ < m_lastMemoizedRow ? -1 : 1;
+    int numberOfElements = numberOfElementsInColumn(i);
+    for (int k = 0; k < k_numberOfRowsEvaluatedAhead; k++) {
+      int row = valuesJ + direction * k;
+      if (row < 0 || row >= numberOfElements) {
+        break;
       }
-    }
-    // Compute the buffer of the new cells of the memoized table
-    int maxI = numberOfValuesColumns() - m_firstMemoizedColumn;
-    for (int ii = 0; ii < std::min(nbOfMemoizedColumns, maxI); ii++) {
-      int maxJ = numberOfElementsInColumn(absoluteColumnForValuesColumn(ii+m_firstMemoizedColumn)) - m_firstMemoizedRow;
-      for (int jj = 0; jj < std::min(k_maxNumberOfDisplayableRows, maxJ); jj++) {
-        // Escape if already filled
-        if (ii >= -offsetI && ii < -offsetI + nbOfMemoizedColumns && jj >= -offsetJ && jj < -offsetJ + k_maxNumberOfDisplayableRows) {
-          continue;
-        }
-        createMemoizedLayout(absoluteColumnForValuesColumn(m_firstMemoizedColumn + ii),
-            absoluteRowForValuesRow(m_firstMemoizedRow + jj),
-            jj * nbOfMemoizedColumns + ii);
+      if (k == 0 || !isMemoized(valuesI, row)) {
+        createMemoizedLayoutAtValuesCell(valuesI, row);
       }
     }
   }
-  return *memoizedLayoutAtIndex((valuesJ-m_firstMemoizedRow)*nbOfMemoizedColumns + (valuesI-m_firstMemoizedColumn));
+  m_lastMemoizedRow = valuesJ;
+  return *memoizedLayoutAtIndex(memoizedIndex(valuesI, valuesJ));
+}
+
+bool ValuesController::cellForMemoizedIndex(int index, int * i, int * j) {
+  assert(0 <= index && index < k_numberOfMemoizedRows * k_maxNumberOfMemoizedColumns);
+  if (m_memoizedRows[index] < 0) {
+    return false;
+  }
+  *i = absoluteColumnForValuesColumn(m_memoizedColumns[index]);
+  *j = absoluteRowForValuesRow(m_memoizedRows[index]);
+  return true;
+}
+
+void ValuesController::createMemoizedLayoutAtValuesCell(int i, int j) {
+  int index = memoizedIndex(i, j);
+  createMemoizedLayout(absoluteColumnForValuesColumn(i), absoluteRowForValuesRow(j), index);
+  m_memoizedColumns[index] = i;
+  m_memoizedRows[index] = j;
 }
 
 void ValuesController::clearSelectedColumn() {
@@ -60,10 +60,17 @@ protected:
   constexpr static int k_notEditableValueCellType = 3; // Must be last for Graph::ValuesController
   constexpr static int k_maxNumberOfDisplayableRows = 10;
   constexpr static int k_numberOfTitleRows = 1;
+  /* When a value cell is not memoized, the next cells of its column in the
+   * scroll direction are evaluated along with it. The memoized rows are
+   * enough to keep the displayed rows and the ones evaluated ahead. */
+  constexpr static int k_numberOfRowsEvaluatedAhead = 4;
+  constexpr static int k_numberOfMemoizedRows = k_maxNumberOfDisplayableRows + k_numberOfRowsEvaluatedAhead - 1;
+  constexpr static int k_maxNumberOfMemoizedColumns = 4;
 
   void initValueCells();
 
   // EditableCellTableViewController
+  bool checkDataAtLocation(double floatBody, int columnIndex, int rowIndex) const override;
   bool setDataAtLocation(double floatBody, int columnIndex, int rowIndex) override;
   void didChangeCell(int column, int row) override;
   int numberOfElementsInColumn(int columnIndex) const override;
@@ -93,11 +100,16 @@ protected:
    * - the table of values cells only (the absolute table from which we pruned
    *   the titles and the abscissa columns)
    * - the memoized table (which is a subset of the table of values cells)
+   * The memoized table is a ring: the cell (i, j) of the table of values cells
+   * can only be memoized at index memoizedIndex(i, j).
    */
   void resetLayoutMemoization();
   virtual Poincare::Layout * memoizedLayoutAtIndex(int i) = 0;
   // Coordinates of memoizedLayoutForCell refer to the absolute table
   Poincare::Layout memoizedLayoutForCell(int i, int j);
+  bool layoutIsMemoizedForCell(int i, int j) { return isMemoized(valuesColumnForAbsoluteColumn(i), valuesRowForAbsoluteRow(j)); }
+  // Coordinates in the absolute table of the cell memoized at index, if any
+  bool cellForMemoizedIndex(int index, int * i, int * j);
 
   Escher::SelectableViewController * columnParameterController() override;
   Shared::ColumnParameters * columnParameters() override;
@@ -122,7 +134,8 @@ private:
   // EditableCellTableViewController
   bool cellAtLocationIsEditable(int columnIndex, int rowIndex) override;
   double dataAtLocation(int columnIndex, int rowIndex) override;
-  int maxNumberOfElements() const override { return Interval::k_maxNumberOfElements; };
+  // Elements can only be appended to intervals that can be edited
+  int maxNumberOfElements() const override { return Interval::k_maxNumberOfEditableElements; };
 
   /* Function evaluation memoization
    * The following 4 methods convert coordinate from the absolute table to the
@@ -134,11 +147,17 @@ private:
   /* Coordinates of createMemoizedLayout refer to the absolute table but the index
    * refers to the memoized table */
   virtual void createMemoizedLayout(int i, int j, int index) = 0;
-  /* m_firstMemoizedColumn and m_firstMemoizedRow are coordinates of the table
-   * of values cells.*/
+  // Coordinates of memoizedIndex refer to the table of values cells
+  int memoizedIndex(int i, int j) { return (j % k_numberOfMemoizedRows) * maxNumberOfDisplayableFunctions() + i % maxNumberOfDisplayableFunctions(); }
+  bool isMemoized(int i, int j) { int index = memoizedIndex(i, j); return m_memoizedColumns[index] == i && m_memoizedRows[index] == j; }
+  void createMemoizedLayoutAtValuesCell(int i, int j);
   virtual int numberOfColumnsForAbscissaColumn(int column) { assert(column == 0); return numberOfColumns(); }
-  mutable int m_firstMemoizedColumn;
-  mutable int m_firstMemoizedRow;
+  /* Coordinates in the table of values cells of the memoized layouts, -1 when
+   * no layout is memoized at an index */
+  int m_memoizedColumns[k_numberOfMemoizedRows * k_maxNumberOfMemoizedColumns];
+  int m_memoizedRows[k_numberOfMemoizedRows * k_maxNumberOfMemoizedColumns];
+  // Last row of the table of values cells read, to find the scroll direction
+  int m_lastMemoizedRow;
 
   virtual void updateSizeMemoizationForColumnAfterIndexChanged(int column, KDCoordinate columnPreviousWidth, int changedRow) {}
 
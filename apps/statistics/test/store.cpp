@@ -4,8 +4,12 @@
 #include <assert.h>
 #include <math.h>
 #include <cmath>
+#include <string.h>
 #include "../store.h"
 #include <poincare/helpers.h>
+#include <poincare/list.h>
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
 #include <poincare/test/helper.h>
 
 using namespace Poincare;
@@ -1062,4 +1066,47 @@ QUIZ_CASE(data_statistics_histograms) {
   }
 }
 
+QUIZ_CASE(data_statistics_binary_list_import) {
+  constexpr int listLength = 3;
+  double v[listLength] = {2.5, -1.0, 4.0};
+  Ion::Storage::FileSystem::sharedFileSystem()->createRecordWithExtension("V2", Ion::Storage::blsExtension, v, sizeof(v));
+
+  GlobalContext context;
+  UserPreferences userPreferences;
+  Store store(&context, &userPreferences);
+  constexpr int seriesIndex = 1;
+  quiz_assert(store.numberOfPairsOfSeries(seriesIndex) == listLength);
+  for (int i = 0; i < listLength; i++) {
+    quiz_assert(store.get(seriesIndex, 0, i) == v[i]);
+    quiz_assert(store.get(seriesIndex, 1, i) == 1.0);
+  }
+  // The binary record is consumed into the lis records
+  Ion::Storage::FileSystem * fileSystem = Ion::Storage::FileSystem::sharedFileSystem();
+  Ion::Storage::Record binaryRecord("V2", Ion::Storage::blsExtension);
+  quiz_assert(!fileSystem->hasRecord(binaryRecord));
+  quiz_assert(fileSystem->hasRecord(Ion::Storage::Record("V2", Ion::Storage::lisExtension)));
+  quiz_assert(fileSystem->hasRecord(Ion::Storage::Record("N2", Ion::Storage::lisExtension)));
+
+  // Columns are not duplicated as binary records when the series is updated
+  store.set(5.0, seriesIndex, 0, 1);
+  quiz_assert(!fileSystem->hasRecord(binaryRecord));
+  quiz_assert(!fileSystem->hasRecord(Ion::Storage::Record("N2", Ion::Storage::blsExtension)));
+
+  // A list edited elsewhere after the import is not overridden
+  List list = List::Builder();
+  list.addChildAtIndexInPlace(Rational::Builder(7), 0, 0);
+  context.setExpressionForSymbolAbstract(list, Symbol::Builder("V2", 2));
+  store.initListsFromStorage();
+  quiz_assert(store.get(seriesIndex, 0, 0) == 7.0);
+
+  // A new export overrides it
+  fileSystem->createRecordWithExtension("V2", Ion::Storage::blsExtension, v, sizeof(v), true);
+  store.initListsFromStorage();
+  quiz_assert(store.numberOfPairsOfSeries(seriesIndex) == listLength);
+  quiz_assert(store.get(seriesIndex, 0, 1) == v[1]);
+  quiz_assert(!fileSystem->hasRecord(binaryRecord));
+
+  store.deleteAllPairs();
+}
+
 }
@@ -3,3 +3,5 @@ EXE = js
 
 EPSILON_TELEMETRY ?= 0
 TERMS_OF_USE ?= 0
+# The browser memory is not sized for a larger Python heap
+CODE_MAX_HEAP_SIZE ?= 65536
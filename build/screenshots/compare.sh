@@ -83,6 +83,9 @@ log args ${arg1_mode} ${arg1} ${arg2_mode} ${arg2}
 
 echo -e "Comparing screenshots"
 
+replay_scenari_folder 1
+replay_scenari_folder 2
+
 for state_file in "${scenari_folder}"/*.nws
 do
   filestem=$(stem "${state_file}")
@@ -51,6 +51,8 @@ log args ${arg1_mode} ${arg1}
 
 echo "Generating screenshots"
 
+replay_scenari_folder 1
+
 for state_file in "${scenari_folder}"/*.nws
 do
   filestem=$(stem "${state_file}")
@@ -61,5 +63,6 @@ do
   # Extract screenshots
   create_img 1 "${out_file1}"
 done
+rm -rf "${output_folder}/images_1"
 print_report
 exit
@@ -47,6 +47,31 @@ function img_for_executable() {
   fi
 }
 
+# replay_scenari_folder <arg_number>
+# Replay the whole scenari folder at once with an executable source, which then
+# becomes a folder source. Older executables without folder replay are kept as
+# they are, and replay state files one at a time.
+function replay_scenari_folder() {
+  log "replay_scenari_folder $1"
+  arg_mode=arg${1}_mode
+  if [[ "${!arg_mode}" == "d" ]]
+  then
+    return
+  fi
+  exe=exe$1
+  images_folder="${output_folder}/images_$1"
+  mkdir -p "${images_folder}"
+  echo "Replay ${scenari_folder} with ${!exe}"
+  cmd="./${!exe} --headless --load-state-file ${scenari_folder} --take-screenshot ${images_folder}"
+  log "${cmd}"
+  eval "$cmd" > /dev/null || true
+  if ls "${images_folder}"/*.png > /dev/null 2>&1
+  then
+    eval arg$1_mode="d"
+    eval arg$1="${images_folder}"
+  fi
+}
+
 function executable_built_path() {
   BUILD_TYPE=debug
   host=$(uname -s)
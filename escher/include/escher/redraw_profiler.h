@@ -0,0 +1,73 @@
+#ifndef ESCHER_REDRAW_PROFILER_H
+#define ESCHER_REDRAW_PROFILER_H
+
+#if ESCHER_REDRAW_PROFILER
+
+#include <ion/display.h>
+#include <kandinsky/rect.h>
+#include <ostream>
+#include <stdint.h>
+
+namespace Escher {
+
+class View;
+
+/* The RedrawProfiler gathers, for each view class, the time spent in drawRect,
+ * the number of pixels pushed to the display, how many of them had already been
+ * pushed since the beginning of the frame (overdraw) and the number of display
+ * transactions. View classes are told apart by their vtable since there is no
+ * RTTI. Pixels pushed outside of any drawRect are gathered in a null class. */
+
+class RedrawProfiler {
+public:
+  struct ViewClassStatistics {
+    const void * vtable;
+    uint32_t numberOfDraws;
+    uint32_t numberOfTransactions;
+    uint64_t drawDurationUs;
+    uint64_t numberOfPixels;
+    uint64_t numberOfOverdrawnPixels;
+  };
+
+  static RedrawProfiler * sharedProfiler();
+
+  void setEnabled(bool enabled);
+  bool isEnabled() const { return m_enabled; }
+  void reset();
+
+  // Called by Window::redraw and View::redraw
+  void frameWillBegin();
+  void frameDidEnd();
+  void viewWillDraw(const View * view);
+  void viewDidDraw();
+
+  int numberOfFrames() const { return m_numberOfFrames; }
+  ViewClassStatistics statisticsOfViewClass(const View * view) const;
+  void log(std::ostream & stream) const;
+
+private:
+  constexpr static int k_maxNumberOfViewClasses = 256;
+
+  RedrawProfiler();
+  static void PushObserver(KDRect rect);
+  static const void * Vtable(const View * view) { return *reinterpret_cast<const void * const *>(view); }
+  ViewClassStatistics * statisticsOfVtable(const void * vtable);
+  void rectWasPushed(KDRect rect);
+
+  ViewClassStatistics m_viewClasses[k_maxNumberOfViewClasses];
+  // Pixels pushed since the beginning of the frame
+  bool m_pushedPixels[Ion::Display::Width * Ion::Display::Height];
+  ViewClassStatistics * m_currentViewClass;
+  uint64_t m_drawStartUs;
+  uint64_t m_frameStartUs;
+  uint64_t m_framesDurationUs;
+  int m_numberOfViewClasses;
+  int m_numberOfFrames;
+  bool m_enabled;
+};
+
+}
+
+#endif
+
+#endif
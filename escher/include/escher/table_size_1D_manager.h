@@ -2,6 +2,7 @@
 #define ESCHER_TABLE_SIZE_1D_MANAGER_H
 
 #include <kandinsky/coordinate.h>
+#include <stdint.h>
 
 namespace Escher {
 
@@ -94,10 +95,73 @@ protected:
   KDCoordinate nonMemoizedCumulatedSizeBeforeIndex(int i) const override;
 };
 
+/* PrefixSumTableSize1DManager are used for long tables which have a variable
+ * height or width. Sizes are indexed in a Fenwick tree as the table is
+ * explored, so that cumulatedSize and indexAfterCumulatedSize only cost
+ * O(log(n)) once the lines have been measured, wherever they are in the
+ * table. Only the first N lines can be indexed, larger tables fall back on a
+ * memoized window of lines. */
+template <int N>
+class PrefixSumTableSize1DManager : public TableSize1DManager {
+public:
+  PrefixSumTableSize1DManager(TableViewDataSource * tableViewDataSource) :
+    m_dataSource(tableViewDataSource),
+    m_numberOfIndexedLines(0),
+    m_memoizationLockedLevel(0)
+  {}
+  KDCoordinate computeSizeAtIndex(int i) override;
+  KDCoordinate computeCumulatedSizeBeforeIndex(int i, KDCoordinate defaultSize) override;
+  int computeIndexAfterCumulatedSize(KDCoordinate offset, KDCoordinate defaultSize) override;
+
+  void resetMemoization(bool force = true) override;
+  void lockMemoization(bool state) const override;
+
+  void updateMemoizationForIndex(int index, KDCoordinate previousSize, KDCoordinate newSize = k_undefinedSize);
+  void deleteIndexFromMemoization(int index, KDCoordinate previousSize);
+protected:
+  constexpr static int k_fallbackMemoizedLinesCount = 10;
+  typedef MemoizedTableSize1DManager<k_fallbackMemoizedLinesCount> FallbackManager;
+  virtual int numberOfLines() const = 0;
+  virtual KDCoordinate nonMemoizedSizeAtIndex(int i) const = 0;
+  // Used instead of the index when the table has more than N lines
+  virtual FallbackManager * fallbackManager() const = 0;
+  TableViewDataSource * m_dataSource;
+private:
+  constexpr static int k_maxNumberOfIndexedLines = N;
+  bool usesFallback() const { return numberOfLines() > k_maxNumberOfIndexedLines; }
+  // Index lines until numberOfLines are indexed, return false if it cannot
+  bool indexLines(int numberOfLines);
+  int32_t indexedCumulatedSizeBeforeIndex(int i) const;
+  void shrinkIndexIfNeeded();
+  KDCoordinate m_sizes[k_maxNumberOfIndexedLines];
+  /* m_partialSums[p-1] is the sum of the sizes of the lines in
+   * [p - lowestBit(p), p - 1]. It may exceed KDCOORDINATE_MAX. */
+  int32_t m_partialSums[k_maxNumberOfIndexedLines];
+  int m_numberOfIndexedLines;
+  mutable int m_memoizationLockedLevel;
+};
+
+template <int N>
+class PrefixSumRowHeightManager : public PrefixSumTableSize1DManager<N> {
+public:
+  PrefixSumRowHeightManager(TableViewDataSource * dataSource) :
+    PrefixSumTableSize1DManager<N>(dataSource),
+    m_fallbackManager(dataSource)
+  {}
+protected:
+  int numberOfLines() const override;
+  KDCoordinate nonMemoizedSizeAtIndex(int i) const override;
+  typename PrefixSumTableSize1DManager<N>::FallbackManager * fallbackManager() const override { return &m_fallbackManager; }
+private:
+  mutable MemoizedRowHeightManager<PrefixSumTableSize1DManager<N>::k_fallbackMemoizedLinesCount> m_fallbackManager;
+};
+
 using ShortMemoizedColumnWidthManager = MemoizedColumnWidthManager<7>;
 using MemoizedOneRowHeightManager = MemoizedRowHeightManager<1>;
 using ShortMemoizedRowHeightManager = MemoizedRowHeightManager<7>;
 using LongMemoizedRowHeightManager = MemoizedRowHeightManager<10>;
+using PrefixSumLongRowHeightManager = PrefixSumRowHeightManager<128>;
+using PrefixSumVeryLongRowHeightManager = PrefixSumRowHeightManager<512>;
 
 }
 #endif
@@ -14,6 +14,8 @@ class TableViewDataSource {
   friend class MemoizedRowHeightManager;
   template <int N>
   friend class MemoizedColumnWidthManager;
+  template <int N>
+  friend class PrefixSumRowHeightManager;
 public:
   virtual void initCellSize(TableView * view) {}
   virtual int numberOfRows() const = 0;
@@ -130,6 +130,10 @@ protected:
     size_t deleteSelection() override;
   protected:
     KDRect glyphFrameAtPosition(const char * text, const char * position) const override;
+    /* Called after every change of the text, with the location from which the
+     * text might have been modified. Content views that memoize data computed
+     * from the text can use it to invalidate what follows location. */
+    virtual void didModifyTextAtLocation(const char * location) {}
     Text m_text;
   };
 
@@ -7,7 +7,12 @@ namespace Escher {
 
 class Window : public View {
 public:
-  Window() : m_contentView(nullptr) {}
+  Window() :
+    m_contentView(nullptr)
+#if ION_EVENTS_JOURNAL
+    , m_skippedRedraw(false)
+#endif
+  {}
   void redraw(bool force = false);
   void setContentView(View * contentView);
 protected:
@@ -20,6 +25,9 @@ protected:
   View * m_contentView;
 private:
   const Window * window() const override;
+#if ION_EVENTS_JOURNAL
+  bool m_skippedRedraw;
+#endif
 };
 
 }
@@ -34,7 +34,6 @@ bool LayoutField::ContentView::setEditing(bool isEditing) {
     /* showEmptyLayoutIfNeeded is done in LayoutField::handleEvent, so no need
      * to do it here. */
     if (m_cursor.hideEmptyLayoutIfNeeded()) {
-      m_expressionView.layout().invalidAllSizesPositionsAndBaselines();
       return true;
     }
   } else {
@@ -391,7 +390,8 @@ void LayoutField::putCursorOnOneSide(LayoutCursor::Position side) {
 }
 
 void LayoutField::reload(KDSize previousSize) {
-  layout().invalidAllSizesPositionsAndBaselines();
+  /* Edited layouts have already dropped their memoized sizes and the ones of
+   * their ancestors (see LayoutNode::didChangeChildren). */
   KDSize newSize = minimalSizeForOptimalDisplay();
   if (m_delegate && previousSize.height() != newSize.height()) {
     m_delegate->layoutFieldDidChangeSize(this);
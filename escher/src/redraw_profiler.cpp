@@ -0,0 +1,175 @@
+#include <escher/redraw_profiler.h>
+
+#if ESCHER_REDRAW_PROFILER
+
+#include <escher/view.h>
+#include <ion/timing.h>
+#include <kandinsky/ion_context.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#if __has_include(<dlfcn.h>) && __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#define ESCHER_REDRAW_PROFILER_SYMBOLS 1
+#endif
+
+namespace Escher {
+
+RedrawProfiler * RedrawProfiler::sharedProfiler() {
+  static RedrawProfiler sProfiler;
+  return &sProfiler;
+}
+
+RedrawProfiler::RedrawProfiler() :
+  m_enabled(false)
+{
+  reset();
+}
+
+void RedrawProfiler::setEnabled(bool enabled) {
+  m_enabled = enabled;
+  KDIonContext::SetPushObserver(enabled ? PushObserver : nullptr);
+}
+
+void RedrawProfiler::reset() {
+  // The first class gathers the pixels pushed outside of any drawRect
+  m_viewClasses[0] = {nullptr, 0, 0, 0, 0, 0};
+  m_numberOfViewClasses = 1;
+  memset(m_pushedPixels, 0, sizeof(m_pushedPixels));
+  m_currentViewClass = nullptr;
+  m_drawStartUs = 0;
+  m_frameStartUs = 0;
+  m_framesDurationUs = 0;
+  m_numberOfFrames = 0;
+}
+
+void RedrawProfiler::frameWillBegin() {
+  if (!m_enabled) {
+    return;
+  }
+  memset(m_pushedPixels, 0, sizeof(m_pushedPixels));
+  m_numberOfFrames++;
+  m_frameStartUs = Ion::Timing::micros();
+}
+
+void RedrawProfiler::frameDidEnd() {
+  if (!m_enabled) {
+    return;
+  }
+  m_framesDurationUs += Ion::Timing::micros() - m_frameStartUs;
+}
+
+void RedrawProfiler::viewWillDraw(const View * view) {
+  if (!m_enabled) {
+    return;
+  }
+  assert(m_currentViewClass == nullptr);
+  m_currentViewClass = statisticsOfVtable(Vtable(view));
+  m_currentViewClass->numberOfDraws++;
+  m_drawStartUs = Ion::Timing::micros();
+}
+
+void RedrawProfiler::viewDidDraw() {
+  if (!m_enabled) {
+    return;
+  }
+  assert(m_currentViewClass != nullptr);
+  m_currentViewClass->drawDurationUs += Ion::Timing::micros() - m_drawStartUs;
+  m_currentViewClass = nullptr;
+}
+
+RedrawProfiler::ViewClassStatistics RedrawProfiler::statisticsOfViewClass(const View * view) const {
+  const void * vtable = Vtable(view);
+  for (int i = 1; i < m_numberOfViewClasses; i++) {
+    if (m_viewClasses[i].vtable == vtable) {
+      return m_viewClasses[i];
+    }
+  }
+  return {vtable, 0, 0, 0, 0, 0};
+}
+
+void RedrawProfiler::PushObserver(KDRect rect) {
+  sharedProfiler()->rectWasPushed(rect);
+}
+
+RedrawProfiler::ViewClassStatistics * RedrawProfiler::statisticsOfVtable(const void * vtable) {
+  for (int i = 1; i < m_numberOfViewClasses; i++) {
+    if (m_viewClasses[i].vtable == vtable) {
+      return m_viewClasses + i;
+    }
+  }
+  if (m_numberOfViewClasses == k_maxNumberOfViewClasses) {
+    // Too many classes, the remaining ones are gathered with the null class
+    return m_viewClasses;
+  }
+  m_viewClasses[m_numberOfViewClasses] = {vtable, 0, 0, 0, 0, 0};
+  return m_viewClasses + m_numberOfViewClasses++;
+}
+
+void RedrawProfiler::rectWasPushed(KDRect rect) {
+  ViewClassStatistics * viewClass = m_currentViewClass ? m_currentViewClass : m_viewClasses;
+  viewClass->numberOfTransactions++;
+  KDRect screenRect = rect.intersectedWith(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height));
+  viewClass->numberOfPixels += screenRect.width() * screenRect.height();
+  for (KDCoordinate y = screenRect.top(); y <= screenRect.bottom(); y++) {
+    bool * pushedPixel = m_pushedPixels + y * Ion::Display::Width + screenRect.left();
+    for (KDCoordinate x = 0; x < screenRect.width(); x++) {
+      viewClass->numberOfOverdrawnPixels += pushedPixel[x];
+      pushedPixel[x] = true;
+    }
+  }
+}
+
+static void logViewClassName(std::ostream & stream, const void * vtable) {
+  if (vtable == nullptr) {
+    stream << "(outside of drawRect)";
+    return;
+  }
+#if ESCHER_REDRAW_PROFILER_SYMBOLS
+  Dl_info info;
+  if (dladdr(vtable, &info) != 0 && info.dli_sname != nullptr) {
+    int status;
+    char * demangledName = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+    if (status == 0) {
+      constexpr const char * k_vtablePrefix = "vtable for ";
+      constexpr size_t k_vtablePrefixLength = sizeof("vtable for ") - 1;
+      bool hasPrefix = strncmp(demangledName, k_vtablePrefix, k_vtablePrefixLength) == 0;
+      stream << (hasPrefix ? demangledName + k_vtablePrefixLength : demangledName);
+      free(demangledName);
+      return;
+    }
+  }
+#endif
+  stream << "View@" << vtable;
+}
+
+void RedrawProfiler::log(std::ostream & stream) const {
+  stream << "<RedrawProfile frames=\"" << m_numberOfFrames
+         << "\" durationUs=\"" << m_framesDurationUs << "\">" << std::endl;
+  // Sort the classes by decreasing drawRect duration
+  int order[k_maxNumberOfViewClasses];
+  for (int i = 0; i < m_numberOfViewClasses; i++) {
+    int j = i;
+    while (j > 0 && m_viewClasses[order[j - 1]].drawDurationUs < m_viewClasses[i].drawDurationUs) {
+      order[j] = order[j - 1];
+      j--;
+    }
+    order[j] = i;
+  }
+  for (int i = 0; i < m_numberOfViewClasses; i++) {
+    const ViewClassStatistics * viewClass = m_viewClasses + order[i];
+    stream << "  <ViewClass name=\"";
+    logViewClassName(stream, viewClass->vtable);
+    stream << "\" draws=\"" << viewClass->numberOfDraws
+           << "\" drawDurationUs=\"" << viewClass->drawDurationUs
+           << "\" pixels=\"" << viewClass->numberOfPixels
+           << "\" overdrawnPixels=\"" << viewClass->numberOfOverdrawnPixels
+           << "\" transactions=\"" << viewClass->numberOfTransactions << "\"/>" << std::endl;
+  }
+  stream << "</RedrawProfile>" << std::endl;
+}
+
+}
+
+#endif
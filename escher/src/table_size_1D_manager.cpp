@@ -288,6 +288,167 @@ KDCoordinate MemoizedRowHeightManager<N>::nonMemoizedCumulatedSizeBeforeIndex(in
   return this->m_dataSource->nonMemoizedCumulatedHeightBeforeIndex(i);
 }
 
+static int lowestBit(int p) {
+  return p & (-p);
+}
+
+template <int N>
+KDCoordinate PrefixSumTableSize1DManager<N>::computeSizeAtIndex(int i) {
+  if (usesFallback()) {
+    return fallbackManager()->computeSizeAtIndex(i);
+  }
+  shrinkIndexIfNeeded();
+  if (i < m_numberOfIndexedLines) {
+    return m_sizes[i];
+  }
+  if (i == m_numberOfIndexedLines && indexLines(i + 1)) {
+    return m_sizes[i];
+  }
+  return k_undefinedSize;
+}
+
+template <int N>
+KDCoordinate PrefixSumTableSize1DManager<N>::computeCumulatedSizeBeforeIndex(int i, KDCoordinate defaultSize) {
+  if (usesFallback()) {
+    return fallbackManager()->computeCumulatedSizeBeforeIndex(i, defaultSize);
+  }
+  shrinkIndexIfNeeded();
+  if (!indexLines(i)) {
+    return k_undefinedSize;
+  }
+  int32_t cumulatedSize = indexedCumulatedSizeBeforeIndex(i);
+  return cumulatedSize > KDCOORDINATE_MAX ? k_undefinedSize : cumulatedSize;
+}
+
+template <int N>
+int PrefixSumTableSize1DManager<N>::computeIndexAfterCumulatedSize(KDCoordinate offset, KDCoordinate defaultSize) {
+  if (usesFallback()) {
+    return fallbackManager()->computeIndexAfterCumulatedSize(offset, defaultSize);
+  }
+  shrinkIndexIfNeeded();
+  int nLines = numberOfLines();
+  // Index lines until offset is covered
+  int32_t cumulatedSize = indexedCumulatedSizeBeforeIndex(m_numberOfIndexedLines);
+  while (offset >= cumulatedSize && m_numberOfIndexedLines < nLines) {
+    if (!indexLines(m_numberOfIndexedLines + 1)) {
+      return k_undefinedSize;
+    }
+    cumulatedSize += m_sizes[m_numberOfIndexedLines - 1];
+  }
+  if (offset >= cumulatedSize) {
+    return nLines;
+  }
+  /* Descend the Fenwick tree to find the number of lines whose cumulated size
+   * is lower than or equal to offset. */
+  int numberOfLinesBefore = 0;
+  int step = 1;
+  while (2 * step <= m_numberOfIndexedLines) {
+    step *= 2;
+  }
+  int32_t remainingOffset = offset;
+  for (; step > 0; step /= 2) {
+    int p = numberOfLinesBefore + step;
+    if (p <= m_numberOfIndexedLines && m_partialSums[p - 1] <= remainingOffset) {
+      numberOfLinesBefore = p;
+      remainingOffset -= m_partialSums[p - 1];
+    }
+  }
+  return numberOfLinesBefore;
+}
+
+template <int N>
+void PrefixSumTableSize1DManager<N>::lockMemoization(bool lockUp) const {
+  // Lines are not indexed while a line size is being computed
+  fallbackManager()->lockMemoization(lockUp);
+  m_memoizationLockedLevel += (lockUp ? 1 : -1);
+  assert(m_memoizationLockedLevel >= 0);
+}
+
+template <int N>
+void PrefixSumTableSize1DManager<N>::resetMemoization(bool force) {
+  fallbackManager()->resetMemoization(force);
+  if (!force && m_memoizationLockedLevel > 0) {
+    return;
+  }
+  m_memoizationLockedLevel = 0;
+  m_numberOfIndexedLines = 0;
+}
+
+template <int N>
+void PrefixSumTableSize1DManager<N>::updateMemoizationForIndex(int index, KDCoordinate previousSize, KDCoordinate newSize) {
+  fallbackManager()->updateMemoizationForIndex(index, previousSize, newSize);
+  if (index >= m_numberOfIndexedLines) {
+    return;
+  }
+  if (newSize == k_undefinedSize) {
+    newSize = nonMemoizedSizeAtIndex(index);
+  }
+  int32_t delta = newSize - m_sizes[index];
+  m_sizes[index] = newSize;
+  for (int p = index + 1; p <= m_numberOfIndexedLines; p += lowestBit(p)) {
+    m_partialSums[p - 1] += delta;
+  }
+}
+
+template <int N>
+void PrefixSumTableSize1DManager<N>::deleteIndexFromMemoization(int index, KDCoordinate previousSize) {
+  fallbackManager()->deleteIndexFromMemoization(index, previousSize);
+  // Lines after index are shifted, they will be indexed again
+  if (index < m_numberOfIndexedLines) {
+    m_numberOfIndexedLines = index;
+  }
+}
+
+template <int N>
+bool PrefixSumTableSize1DManager<N>::indexLines(int numberOfLines) {
+  if (numberOfLines <= m_numberOfIndexedLines) {
+    return true;
+  }
+  if (numberOfLines > k_maxNumberOfIndexedLines || m_memoizationLockedLevel > 0) {
+    return false;
+  }
+  while (m_numberOfIndexedLines < numberOfLines) {
+    int i = m_numberOfIndexedLines;
+    lockMemoization(true);
+    KDCoordinate size = nonMemoizedSizeAtIndex(i);
+    lockMemoization(false);
+    int p = i + 1;
+    m_sizes[i] = size;
+    m_partialSums[i] = size + indexedCumulatedSizeBeforeIndex(i) - indexedCumulatedSizeBeforeIndex(p - lowestBit(p));
+    m_numberOfIndexedLines++;
+  }
+  return true;
+}
+
+template <int N>
+int32_t PrefixSumTableSize1DManager<N>::indexedCumulatedSizeBeforeIndex(int i) const {
+  assert(i <= m_numberOfIndexedLines);
+  int32_t cumulatedSize = 0;
+  for (int p = i; p > 0; p -= lowestBit(p)) {
+    cumulatedSize += m_partialSums[p - 1];
+  }
+  return cumulatedSize;
+}
+
+template <int N>
+void PrefixSumTableSize1DManager<N>::shrinkIndexIfNeeded() {
+  // Lines might have been removed at the end of the table
+  int nLines = numberOfLines();
+  if (m_numberOfIndexedLines > nLines) {
+    m_numberOfIndexedLines = nLines;
+  }
+}
+
+template <int N>
+int PrefixSumRowHeightManager<N>::numberOfLines() const {
+  return this->m_dataSource->numberOfRows();
+}
+
+template <int N>
+KDCoordinate PrefixSumRowHeightManager<N>::nonMemoizedSizeAtIndex(int i) const {
+  return this->m_dataSource->nonMemoizedRowHeight(i);
+}
+
 template class MemoizedTableSize1DManager<1>;
 template class MemoizedTableSize1DManager<7>;
 template class MemoizedTableSize1DManager<10>;
@@ -298,5 +459,10 @@ template class MemoizedRowHeightManager<1>;
 template class MemoizedRowHeightManager<7>;
 template class MemoizedRowHeightManager<10>;
 
+template class PrefixSumTableSize1DManager<128>;
+template class PrefixSumRowHeightManager<128>;
+template class PrefixSumTableSize1DManager<512>;
+template class PrefixSumRowHeightManager<512>;
+
 
 }
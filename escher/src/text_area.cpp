@@ -552,6 +552,7 @@ KDSize TextArea::ContentView::minimalSizeForOptimalDisplay() const {
 void TextArea::ContentView::setText(char * textBuffer, size_t textBufferSize) {
   m_text.setText(textBuffer, textBufferSize);
   m_cursorLocation = text();
+  didModifyTextAtLocation(text());
 }
 
 bool TextArea::ContentView::insertTextAtLocation(const char * text, char * location, int textLength) {
@@ -567,6 +568,7 @@ bool TextArea::ContentView::insertTextAtLocation(const char * text, char * locat
   m_text.insertText(text, textLen, location);
   // Replace System parentheses (used to keep layout tree structure) by normal parentheses
   Poincare::SerializationHelper::ReplaceSystemParenthesesAndBracesByUserParentheses(location, textLen);
+  didModifyTextAtLocation(location);
   reloadRectFromPosition(location, lineBreak);
   return true;
 }
@@ -580,6 +582,7 @@ bool TextArea::ContentView::removePreviousGlyph() {
   char * cursorLoc = const_cast<char *>(cursorLocation());
   lineBreak = m_text.removePreviousGlyph(&cursorLoc) == '\n';
   setCursorLocation(cursorLoc); // Update the cursor
+  didModifyTextAtLocation(cursorLoc);
   layoutSubviews(); // Reposition the cursor
   reloadRectFromPosition(cursorLocation(), lineBreak);
   return true;
@@ -588,6 +591,7 @@ bool TextArea::ContentView::removePreviousGlyph() {
 bool TextArea::ContentView::removeEndOfLine() {
   size_t removedLine = m_text.removeRemainingLine(cursorLocation(), 1);
   if (removedLine > 0) {
+    didModifyTextAtLocation(cursorLocation());
     layoutSubviews();
     reloadRectFromPosition(cursorLocation(), false);
     return true;
@@ -604,6 +608,7 @@ bool TextArea::ContentView::removeStartOfLine() {
   if (removedLine > 0) {
     assert(cursorLocation() >= text() + removedLine);
     setCursorLocation(cursorLocation() - removedLine);
+    didModifyTextAtLocation(cursorLocation());
     reloadRectFromPosition(cursorLocation(), true);
     return true;
   }
@@ -611,7 +616,11 @@ bool TextArea::ContentView::removeStartOfLine() {
 }
 
 size_t TextArea::ContentView::removeText(const char * start, const char * end) {
-  return m_text.removeText(start, end);
+  size_t removedLength = m_text.removeText(start, end);
+  if (removedLength > 0) {
+    didModifyTextAtLocation(start);
+  }
+  return removedLength;
 }
 
 size_t TextArea::ContentView::deleteSelection() {
@@ -1,5 +1,8 @@
 #include <escher/view.h>
 #include <kandinsky/ion_context.h>
+#if ESCHER_REDRAW_PROFILER
+#include <escher/redraw_profiler.h>
+#endif
 
 extern "C" {
 #include <assert.h>
@@ -52,7 +55,13 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     KDContext * ctx = KDIonContext::SharedContext();
     ctx->setOrigin(absOrigin);
     ctx->setClippingRect(absClippingRect);
+#if ESCHER_REDRAW_PROFILER
+    RedrawProfiler::sharedProfiler()->viewWillDraw(this);
+#endif
     this->drawRect(ctx, rectNeedingRedraw);
+#if ESCHER_REDRAW_PROFILER
+    RedrawProfiler::sharedProfiler()->viewDidDraw();
+#endif
   }
   // This initializes the area that has been redrawn.
   KDRect redrawnArea = rectNeedingRedraw;
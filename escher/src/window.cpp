@@ -1,5 +1,8 @@
 #include <escher/window.h>
 #include <ion.h>
+#if ESCHER_REDRAW_PROFILER
+#include <escher/redraw_profiler.h>
+#endif
 extern "C" {
 #include <assert.h>
 }
@@ -7,11 +10,27 @@ extern "C" {
 namespace Escher {
 
 void Window::redraw(bool force) {
+#if ION_EVENTS_JOURNAL
+  if (Ion::Events::isFastForwarding()) {
+    m_skippedRedraw = true;
+    return;
+  }
+  /* View dirty rects are not resilient to several layouts without redraw, so
+   * the first frame drawn after skipped ones is a full one. */
+  force = force || m_skippedRedraw;
+  m_skippedRedraw = false;
+#endif
   if (force) {
     markRectAsDirty(bounds());
   }
   Ion::Display::waitForVBlank();
+#if ESCHER_REDRAW_PROFILER
+  RedrawProfiler::sharedProfiler()->frameWillBegin();
+#endif
   View::redraw(bounds());
+#if ESCHER_REDRAW_PROFILER
+  RedrawProfiler::sharedProfiler()->frameDidEnd();
+#endif
 }
 
 void Window::setContentView(View * contentView) {
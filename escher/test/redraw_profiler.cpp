@@ -0,0 +1,42 @@
+#include <quiz.h>
+#include <escher/redraw_profiler.h>
+#include <escher/window.h>
+
+#if ESCHER_REDRAW_PROFILER
+
+using namespace Escher;
+
+class OverdrawingView : public View {
+public:
+  void drawRect(KDContext * ctx, KDRect rect) const override {
+    ctx->fillRect(rect, KDColorRed);
+    ctx->fillRect(rect, KDColorBlue);
+  }
+};
+
+QUIZ_CASE(escher_redraw_profiler) {
+  RedrawProfiler * profiler = RedrawProfiler::sharedProfiler();
+  profiler->reset();
+  profiler->setEnabled(true);
+
+  OverdrawingView view;
+  Window window;
+  window.setFrame(KDRect(0, 0, 100, 50), false);
+  window.setContentView(&view);
+  window.redraw();
+  window.redraw(true);
+
+  RedrawProfiler::ViewClassStatistics statistics = profiler->statisticsOfViewClass(&view);
+  quiz_assert(profiler->numberOfFrames() == 2);
+  quiz_assert(statistics.numberOfDraws == 2);
+  quiz_assert(statistics.numberOfTransactions == 4);
+  quiz_assert(statistics.numberOfPixels == 4 * 100 * 50);
+  // Each pixel is overdrawn once per frame
+  quiz_assert(statistics.numberOfOverdrawnPixels == 2 * 100 * 50);
+  quiz_assert(profiler->statisticsOfViewClass(&window).numberOfPixels == 0);
+
+  profiler->setEnabled(false);
+  profiler->reset();
+}
+
+#endif
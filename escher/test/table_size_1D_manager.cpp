@@ -0,0 +1,60 @@
+#include <quiz.h>
+#include <escher/table_view_data_source.h>
+
+using namespace Escher;
+
+class VariableHeightDataSource : public TableViewDataSource {
+public:
+  VariableHeightDataSource(int numberOfRows) : m_numberOfRows(numberOfRows), m_heightManager(this) {}
+  int numberOfRows() const override { return m_numberOfRows; }
+  int numberOfColumns() const override { return 1; }
+  HighlightCell * reusableCell(int index, int type) override { return nullptr; }
+  int reusableCellCount(int type) override { return 0; }
+  int typeAtLocation(int i, int j) override { return 0; }
+  KDCoordinate height(int j) const { return j % 5 == 3 ? 0 : 10 + (7 * j) % 13 + m_extraHeight * (j == 40); }
+  void setExtraHeight(KDCoordinate extraHeight) {
+    KDCoordinate previousHeight = height(40);
+    m_extraHeight = extraHeight;
+    m_heightManager.updateMemoizationForIndex(40, previousHeight);
+  }
+  void setNumberOfRows(int numberOfRows) { m_numberOfRows = numberOfRows; }
+private:
+  KDCoordinate nonMemoizedRowHeight(int j) override { return height(j); }
+  TableSize1DManager * rowHeightManager() override { return &m_heightManager; }
+  int m_numberOfRows;
+  KDCoordinate m_extraHeight = 0;
+  PrefixSumLongRowHeightManager m_heightManager;
+};
+
+static void assert_sizes_are_consistent(VariableHeightDataSource * dataSource) {
+  int n = dataSource->numberOfRows();
+  KDCoordinate cumulatedHeight = 0;
+  // Query from the bottom first to jump over unindexed rows
+  quiz_assert(dataSource->indexAfterCumulatedHeight(KDCOORDINATE_MAX) == n);
+  for (int j = 0; j < n; j++) {
+    quiz_assert(dataSource->cumulatedHeightBeforeIndex(j) == cumulatedHeight);
+    quiz_assert(dataSource->rowHeight(j) == dataSource->height(j));
+    for (KDCoordinate offset = cumulatedHeight; offset < cumulatedHeight + dataSource->height(j); offset++) {
+      quiz_assert(dataSource->indexAfterCumulatedHeight(offset) == j);
+    }
+    cumulatedHeight += dataSource->height(j);
+  }
+  quiz_assert(dataSource->cumulatedHeightBeforeIndex(n) == cumulatedHeight);
+}
+
+QUIZ_CASE(escher_prefix_sum_table_size_manager) {
+  VariableHeightDataSource dataSource(100);
+  assert_sizes_are_consistent(&dataSource);
+  dataSource.setExtraHeight(25);
+  assert_sizes_are_consistent(&dataSource);
+  dataSource.setNumberOfRows(57);
+  assert_sizes_are_consistent(&dataSource);
+  // Tables larger than the index fall back on a memoized window of rows
+  dataSource.setNumberOfRows(200);
+  dataSource.resetMemoization();
+  assert_sizes_are_consistent(&dataSource);
+  dataSource.setExtraHeight(10);
+  assert_sizes_are_consistent(&dataSource);
+  dataSource.setNumberOfRows(100);
+  assert_sizes_are_consistent(&dataSource);
+}
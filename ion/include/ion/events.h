@@ -62,6 +62,10 @@ private:
 
 void replayFrom(Journal * l);
 void logTo(Journal * l);
+/* When fast-forwarding, only the state reached at the end of the replayed
+ * journal is displayed: intermediate frames are not drawn. */
+void setFastForward(bool fastForward);
+bool isFastForwarding();
 #endif
 
 enum class ShiftAlphaStatus : uint8_t {
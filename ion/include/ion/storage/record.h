@@ -14,6 +14,10 @@ constexpr static char funcExtension[] = "func";
 constexpr static char lisExtension[] = "lis";
 constexpr static char seqExtension[] = "seq";
 constexpr static char matExtension[] = "mat";
+/* Binary list records hold doubles in the native byte order, with no header.
+ * Unlike lis records, which are Poincare trees, they can be read and written
+ * without the pool, by Python scripts for instance. */
+constexpr static char blsExtension[] = "bls";
 
 /*  * A record's fullName is baseName.extension.
  * A Record is identified by the CRC32 on its fullName because:
@@ -13,6 +13,12 @@ void msleep(uint32_t ms);
  * On the device, epoch is the boot time. */
 uint64_t millis();
 
+#if !PLATFORM_DEVICE
+/* micros is only available on the simulator, where it is used to profile
+ * code with a finer resolution than millis. */
+uint64_t micros();
+#endif
+
 }
 }
 
@@ -80,14 +80,27 @@ const char * Event::text() const {
 
 static Journal * sSourceJournal = nullptr;
 static Journal * sDestinationJournal = nullptr;
+static bool sFastForward = false;
 void replayFrom(Journal * l) { sSourceJournal = l; }
 void logTo(Journal * l) { sDestinationJournal = l; }
+void setFastForward(bool fastForward) { sFastForward = fastForward; }
+
+bool isFastForwarding() {
+  /* The frame following the last replayed event is drawn, so that the final
+   * state is on screen when the screenshot is taken. */
+  return sFastForward && sSourceJournal != nullptr && !sSourceJournal->isEmpty();
+}
 
 Event getEvent(int * timeout) {
   Event res = Events::None;
   // Replay
   if (sSourceJournal != nullptr) {
-    if (sSourceJournal->isEmpty()) {
+    if (sSourceJournal->isEmpty() && sFastForward) {
+      /* Intermediate frames have been skipped: a TimerFire makes the run loop
+       * draw the final state before it is captured. */
+      sFastForward = false;
+      res = TimerFire;
+    } else if (sSourceJournal->isEmpty()) {
       sSourceJournal = nullptr;
 #if ESCHER_LOG_EVENTS_NAME
       Ion::Console::writeLine("----- STATE FILE FULLY LOADED -----");
@@ -23,6 +23,14 @@ extern "C" {
   extern size_t eadk_external_data_size;
 }
 #include <dlfcn.h>
+#if !defined(_WIN32)
+#include <dirent.h>
+#include <stdlib.h>
+#include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 #endif
 
 /* The Args class allows parsing and editing command-line arguments
@@ -123,6 +131,81 @@ static inline int load_eadk_external_data(const char * path) {
 }
 #endif
 
+#if ION_SIMULATOR_FILES && !defined(_WIN32)
+static bool isFolder(const char * path) {
+  struct stat pathStat;
+  return stat(path, &pathStat) == 0 && S_ISDIR(pathStat.st_mode);
+}
+
+static bool waitForReplay(const std::vector<std::string> & stems, const std::vector<pid_t> & pids) {
+  int status;
+  pid_t pid = wait(&status);
+  bool success = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  if (!success) {
+    auto pidIt = std::find(pids.begin(), pids.end(), pid);
+    assert(pidIt != pids.end());
+    fprintf(stderr, "Replay failed: %s\n", stems[pidIt - pids.begin()].c_str());
+  }
+  return success;
+}
+
+/* The state of Epsilon (storage, apps snapshots, pool...) is global, so each
+ * state file of the folder is replayed in its own forked process, with at most
+ * numberOfJobs of them running at once. The parent process returns the number
+ * of failed replays. Child processes return -1, with stateFile and
+ * screenshotPath set to the files they have to handle. */
+static int replayStateFileFolder(const char * folder, const char * screenshotFolder, int numberOfJobs, std::string * stateFile, std::string * screenshotPath) {
+  DIR * dir = opendir(folder);
+  if (dir == nullptr) {
+    fprintf(stderr, "Error opening state file folder %s\n", folder);
+    return 1;
+  }
+  std::vector<std::string> stems;
+  while (struct dirent * entry = readdir(dir)) {
+    size_t length = strlen(entry->d_name);
+    constexpr size_t k_extensionLength = sizeof(".nws") - 1;
+    if (length > k_extensionLength && strcmp(entry->d_name + length - k_extensionLength, ".nws") == 0) {
+      stems.push_back(std::string(entry->d_name, length - k_extensionLength));
+    }
+  }
+  closedir(dir);
+  std::sort(stems.begin(), stems.end());
+
+  std::vector<pid_t> pids(stems.size(), -1);
+  int numberOfRunningJobs = 0;
+  int numberOfFailures = 0;
+  for (size_t i = 0; i < stems.size(); i++) {
+    if (numberOfRunningJobs == numberOfJobs) {
+      numberOfFailures += !waitForReplay(stems, pids);
+      numberOfRunningJobs--;
+    }
+    // Do not duplicate buffered outputs in the child
+    fflush(stdout);
+    fflush(stderr);
+    pids[i] = fork();
+    if (pids[i] == 0) {
+      *stateFile = std::string(folder) + "/" + stems[i] + ".nws";
+      if (screenshotFolder) {
+        *screenshotPath = std::string(screenshotFolder) + "/" + stems[i] + ".png";
+      }
+      return -1;
+    }
+    if (pids[i] < 0) {
+      fprintf(stderr, "Replay failed: %s\n", stems[i].c_str());
+      numberOfFailures++;
+      continue;
+    }
+    numberOfRunningJobs++;
+  }
+  while (numberOfRunningJobs > 0) {
+    numberOfFailures += !waitForReplay(stems, pids);
+    numberOfRunningJobs--;
+  }
+  printf("%d state files replayed, %d failed\n", static_cast<int>(stems.size()), numberOfFailures);
+  return numberOfFailures;
+}
+#endif
+
 using namespace Ion::Simulator;
 
 int main(int argc, char * argv[]) {
@@ -139,9 +222,39 @@ int main(int argc, char * argv[]) {
 
 #if ION_SIMULATOR_FILES
   const char * stateFile = args.pop("--load-state-file");
+  const char * screenshotPath = args.pop("--take-screenshot");
+#if !defined(_WIN32)
+  /* A whole folder of state files can be replayed headless at once, with
+   * --take-screenshot naming the folder where screenshots are saved. */
+  if (stateFile && isFolder(stateFile)) {
+    // --jobs is left to the test runner unless a folder is replayed
+    const char * jobs = args.pop("--jobs");
+    if (!args.has("--headless")) {
+      fprintf(stderr, "Error: a folder of state files can only be replayed with --headless\n");
+      return -1;
+    }
+    static std::string sFolderStateFile;
+    static std::string sFolderScreenshotPath;
+    int numberOfJobs = jobs ? atoi(jobs) : sysconf(_SC_NPROCESSORS_ONLN);
+    int numberOfFailures = replayStateFileFolder(stateFile, screenshotPath, numberOfJobs < 1 ? 1 : numberOfJobs, &sFolderStateFile, &sFolderScreenshotPath);
+    if (numberOfFailures >= 0) {
+      return numberOfFailures > 0;
+    }
+    stateFile = sFolderStateFile.c_str();
+    screenshotPath = screenshotPath ? sFolderScreenshotPath.c_str() : nullptr;
+  }
+#endif
+  const char * allScreenshotsFolder = args.pop("--take-all-screenshots");
+  bool fastForward = args.popFlag("--fast-forward");
+
   if (stateFile) {
     assert(Journal::replayJournal());
     StateFile::load(stateFile);
+    /* Headless replays can skip the drawing of intermediate states, unless
+     * each step is captured. It is opt-in because some views update their
+     * state while being drawn (the graph range for instance), so the final
+     * screen can differ from a regular replay. */
+    Ion::Events::setFastForward(fastForward && args.has("--headless") && !allScreenshotsFolder);
     const char * replayJournalLanguage = Journal::replayJournal()->startingLanguage();
     if (replayJournalLanguage[0] != 0) {
       // Override any language setting if there is
@@ -150,12 +263,10 @@ int main(int argc, char * argv[]) {
     }
   }
 
-  const char * screenshotPath = args.pop("--take-screenshot");
   if (screenshotPath) {
     Ion::Simulator::Screenshot::commandlineScreenshot()->init(screenshotPath);
   }
 
-  const char * allScreenshotsFolder = args.pop("--take-all-screenshots");
   if (allScreenshotsFolder) {
     Ion::Simulator::Screenshot::commandlineScreenshot()->initEachStep(allScreenshotsFolder);
   }
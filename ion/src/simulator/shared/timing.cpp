@@ -13,6 +13,11 @@ uint64_t millis() {
   return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
 }
 
+uint64_t micros() {
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
 void msleep(uint32_t ms) {
   if (Simulator::Window::isHeadless()) {
     return;
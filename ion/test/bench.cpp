@@ -0,0 +1,37 @@
+#include <quiz.h>
+#include <ion/storage/file_system.h>
+
+using namespace Ion;
+
+constexpr static int k_numberOfBenchRecords = 20;
+
+static void setBenchRecordBaseName(char * baseName, int i) {
+  // baseName is "benchRecordXX"
+  baseName[11] = '0' + i / 10;
+  baseName[12] = '0' + i % 10;
+}
+
+static bool sRecordsCreated = false;
+
+static void destroyBenchRecords() {
+  Storage::FileSystem::sharedFileSystem()->destroyRecordsWithExtension("bench");
+  sRecordsCreated = false;
+}
+
+QUIZ_BENCH(ion_storage_record_named) {
+  Storage::FileSystem * fileSystem = Storage::FileSystem::sharedFileSystem();
+  char baseName[] = "benchRecord00";
+  // The records are created on the first iteration only
+  if (!sRecordsCreated) {
+    for (int i = 0; i < k_numberOfBenchRecords; i++) {
+      setBenchRecordBaseName(baseName, i);
+      fileSystem->createRecordWithExtension(baseName, "bench", baseName, sizeof(baseName));
+    }
+    sRecordsCreated = true;
+    quiz_bench_set_teardown(destroyBenchRecords);
+  }
+  for (int i = 0; i < k_numberOfBenchRecords; i++) {
+    setBenchRecordBaseName(baseName, i);
+    quiz_assert(!fileSystem->recordBaseNamedWithExtension(baseName, "bench").isNull());
+  }
+}
@@ -32,6 +32,10 @@ public:
   }
 
   static KDColor Blend(KDColor first, KDColor second, uint8_t alpha);
+  /* Span versions of Blend, which compute pixels[i] = Blend(pixels[i], second,
+   * alphas[i]) and pixels[i] = Blend(first, second, alphas[i]) respectively. */
+  static void BlendSpan(KDColor * pixels, KDColor second, const uint8_t * alphas, int length);
+  static void BlendSpan(KDColor * pixels, KDColor first, KDColor second, const uint8_t * alphas, int length);
   operator uint16_t() const { return m_value; }
 
   struct HSVColor {
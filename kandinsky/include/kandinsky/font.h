@@ -87,6 +87,7 @@ public:
   GlyphIndex indexForCodePoint(CodePoint c) const;
 
   void setGlyphGrayscalesForCodePoint(CodePoint codePoint, GlyphBuffer * glyphBuffer) const;
+  void setGlyphGrayscalesForGlyphIndex(GlyphIndex index, GlyphBuffer * glyphBuffer) const;
   void setGlyphGrayscalesForCharacter(char c, GlyphBuffer * glyphBuffer) const;
   void accumulateGlyphGrayscalesForCodePoint(CodePoint codePoint, GlyphBuffer * glyphBuffer) const;
 
@@ -0,0 +1,46 @@
+#ifndef KANDINSKY_GLYPH_CACHE_H
+#define KANDINSKY_GLYPH_CACHE_H
+
+#if KANDINSKY_GLYPH_CACHE_SIZE
+
+#include <kandinsky/color.h>
+#include <kandinsky/font.h>
+#include <stdint.h>
+
+/* KDGlyphCache keeps decompressed and colorized glyphs, so that redrawing the
+ * same text with the same colors only copies pixels. It is 4-way set
+ * associative: a glyph can only be stored in the set given by its key, where
+ * the least recently used glyph is evicted. Glyphs combined with diacritics are
+ * not cached. */
+
+class KDGlyphCache {
+public:
+  static KDGlyphCache * SharedCache();
+
+  const KDColor * glyph(KDFont::Size size, KDFont::GlyphIndex index, KDColor textColor, KDColor backgroundColor);
+  void reset();
+
+  int numberOfHits() const { return m_numberOfHits; }
+  int numberOfMisses() const { return m_numberOfMisses; }
+
+private:
+  constexpr static int k_numberOfWays = 4;
+  constexpr static int k_numberOfSets = KANDINSKY_GLYPH_CACHE_SIZE / k_numberOfWays;
+  static_assert(k_numberOfSets > 0 && KANDINSKY_GLYPH_CACHE_SIZE % k_numberOfWays == 0, "KANDINSKY_GLYPH_CACHE_SIZE should be a multiple of 4");
+  constexpr static uint64_t k_emptyKey = UINT64_MAX;
+
+  KDGlyphCache() { reset(); }
+  static uint64_t Key(KDFont::Size size, KDFont::GlyphIndex index, KDColor textColor, KDColor backgroundColor);
+
+  KDColor m_glyphs[KANDINSKY_GLYPH_CACHE_SIZE][KDFont::k_maxGlyphPixelCount];
+  uint64_t m_keys[KANDINSKY_GLYPH_CACHE_SIZE];
+  // Time of last use, to find the least recently used glyph of a set
+  uint32_t m_lastUses[KANDINSKY_GLYPH_CACHE_SIZE];
+  uint32_t m_time;
+  int m_numberOfHits;
+  int m_numberOfMisses;
+};
+
+#endif
+
+#endif
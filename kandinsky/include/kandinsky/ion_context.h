@@ -8,11 +8,20 @@ public:
   static KDIonContext * SharedContext();
   static void Putchar(char c);
   static void Clear(KDPoint newCursorPosition = KDPointZero);
+#if !PLATFORM_DEVICE
+  /* The push observer is given every rectangle pushed to the display, which is
+   * used to profile drawing. */
+  typedef void (*PushObserver)(KDRect rect);
+  static void SetPushObserver(PushObserver observer) { s_pushObserver = observer; }
+#endif
 private:
   KDIonContext();
   void pushRect(KDRect rect, const KDColor * pixels) override;
   void pushRectUniform(KDRect rect, KDColor color) override;
   void pullRect(KDRect rect, KDColor * pixels) override;
+#if !PLATFORM_DEVICE
+  static PushObserver s_pushObserver;
+#endif
 };
 
 #endif
@@ -77,11 +77,9 @@ void KDContext::fillRectWithMask(KDRect rect, KDColor color, KDColor background,
   startingI = std::max<KDCoordinate>(0, startingI);
   startingJ = std::max<KDCoordinate>(0, startingJ);
   for (KDCoordinate j=0; j<absoluteRect.height(); j++) {
-    for (KDCoordinate i=0; i<absoluteRect.width(); i++) {
-      KDColor * currentPixelAddress = workingBuffer + i + absoluteRect.width()*j;
-      const uint8_t * currentMaskAddress = mask + i + startingI + rect.width()*(j + startingJ);
-      *currentPixelAddress = KDColor::Blend(background, color, *currentMaskAddress);
-    }
+    KDColor * rowPixels = workingBuffer + absoluteRect.width()*j;
+    const uint8_t * rowMask = mask + startingI + rect.width()*(j + startingJ);
+    KDColor::BlendSpan(rowPixels, background, color, rowMask, absoluteRect.width());
   }
   pushRect(absoluteRect, workingBuffer);
 }
@@ -103,12 +101,9 @@ void KDContext::blendRectWithMask(KDRect rect, KDColor color, const uint8_t * ma
   startingI = std::max<KDCoordinate>(0, startingI);
   startingJ = std::max<KDCoordinate>(0, startingJ);
   for (KDCoordinate j=0; j<absoluteRect.height(); j++) {
-    for (KDCoordinate i=0; i<absoluteRect.width(); i++) {
-      KDColor * currentPixelAddress = workingBuffer + i + absoluteRect.width()*j;
-      const uint8_t * currentMaskAddress = mask + i + startingI + rect.width()*(j + startingJ);
-      *currentPixelAddress = KDColor::Blend(*currentPixelAddress, color, *currentMaskAddress);
-      //*currentPixelAddress = KDColorBlend(*currentPixelAddress, color, *currentMaskAddress);
-    }
+    KDColor * rowPixels = workingBuffer + absoluteRect.width()*j;
+    const uint8_t * rowMask = mask + startingI + rect.width()*(j + startingJ);
+    KDColor::BlendSpan(rowPixels, color, rowMask, absoluteRect.width());
   }
   pushRect(absoluteRect, workingBuffer);
 }
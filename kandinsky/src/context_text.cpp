@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <kandinsky/context.h>
 #include <kandinsky/font.h>
+#include <kandinsky/glyph_cache.h>
 #include <ion/unicode/utf8_decoder.h>
 #include <ion/display.h>
 #include <cmath>
@@ -69,9 +70,28 @@ KDPoint KDContext::drawString(const char * text, KDPoint p, KDFont::Size font, K
     } else {
       assert(!codePoint.isCombining());
       // We don't want to draw '�'
-      assert(KDFont::Font(font)->indexForCodePoint(codePoint) != KDFont::k_indexForReplacementCharacterCodePoint);
-      KDFont::Font(font)->setGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
+      KDFont::GlyphIndex glyphIndex = KDFont::Font(font)->indexForCodePoint(codePoint);
+      assert(glyphIndex != KDFont::k_indexForReplacementCharacterCodePoint);
+      KDRect glyphRect(position, glyphSize);
       codePoint = decoder.nextCodePoint();
+      if (absoluteFillRect(glyphRect).isEmpty()) {
+        // The glyph is clipped out, there is no need to render it
+        while (codePoint.isCombining()) {
+          codePointPointer = decoder.stringPosition();
+          codePoint = decoder.nextCodePoint();
+        }
+        position = position.translatedBy(KDPoint(glyphSize.width(), 0));
+        continue;
+      }
+#if KANDINSKY_GLYPH_CACHE_SIZE
+      if (!codePoint.isCombining()) {
+        const KDColor * glyph = KDGlyphCache::SharedCache()->glyph(font, glyphIndex, textColor, backgroundColor);
+        fillRectWithPixels(glyphRect, glyph, glyphBuffer.colorBuffer());
+        position = position.translatedBy(KDPoint(glyphSize.width(), 0));
+        continue;
+      }
+#endif
+      KDFont::Font(font)->setGlyphGrayscalesForGlyphIndex(glyphIndex, &glyphBuffer);
       while (codePoint.isCombining()) {
         KDFont::Font(font)->accumulateGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
         codePointPointer = decoder.stringPosition();
@@ -80,7 +100,7 @@ KDPoint KDContext::drawString(const char * text, KDPoint p, KDFont::Size font, K
       KDFont::Font(font)->colorizeGlyphBuffer(&palette, &glyphBuffer);
       // Push the character on the screen
       fillRectWithPixels(
-          KDRect(position, glyphSize),
+          glyphRect,
           glyphBuffer.colorBuffer(),
           glyphBuffer.colorBuffer() // It's OK to trash the content of the color buffer since we'll re-fetch it for the next char anyway
           );
@@ -41,6 +41,10 @@ void KDFont::setGlyphGrayscalesForCodePoint(CodePoint codePoint, GlyphBuffer * g
   fetchGrayscaleGlyphAtIndex(indexForCodePoint(codePoint), glyphBuffer->grayscaleBuffer());
 }
 
+void KDFont::setGlyphGrayscalesForGlyphIndex(GlyphIndex index, GlyphBuffer * glyphBuffer) const {
+  fetchGrayscaleGlyphAtIndex(index, glyphBuffer->grayscaleBuffer());
+}
+
 void KDFont::setGlyphGrayscalesForCharacter(const char c, GlyphBuffer * glyphBuffer) const {
   fetchGrayscaleGlyphAtIndex(signedCharAsIndex(c), glyphBuffer->grayscaleBuffer());
 }
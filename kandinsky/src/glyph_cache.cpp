@@ -0,0 +1,60 @@
+#include <kandinsky/glyph_cache.h>
+
+#if KANDINSKY_GLYPH_CACHE_SIZE
+
+#include <string.h>
+
+KDGlyphCache * KDGlyphCache::SharedCache() {
+  static KDGlyphCache sCache;
+  return &sCache;
+}
+
+uint64_t KDGlyphCache::Key(KDFont::Size size, KDFont::GlyphIndex index, KDColor textColor, KDColor backgroundColor) {
+  static_assert(sizeof(KDFont::GlyphIndex) == 1, "Key layout expects 8-bit glyph indexes");
+  return static_cast<uint64_t>(index)
+    | static_cast<uint64_t>(size == KDFont::Size::Large) << 8
+    | static_cast<uint64_t>(static_cast<uint16_t>(textColor)) << 16
+    | static_cast<uint64_t>(static_cast<uint16_t>(backgroundColor)) << 32;
+}
+
+void KDGlyphCache::reset() {
+  for (int i = 0; i < KANDINSKY_GLYPH_CACHE_SIZE; i++) {
+    m_keys[i] = k_emptyKey;
+    m_lastUses[i] = 0;
+  }
+  m_time = 0;
+  m_numberOfHits = 0;
+  m_numberOfMisses = 0;
+}
+
+const KDColor * KDGlyphCache::glyph(KDFont::Size size, KDFont::GlyphIndex index, KDColor textColor, KDColor backgroundColor) {
+  uint64_t key = Key(size, index, textColor, backgroundColor);
+  // Fibonacci hashing spreads the colors and glyphs over the sets
+  int firstWay = static_cast<int>(((key * 0x9E3779B97F4A7C15ull) >> 32) % k_numberOfSets) * k_numberOfWays;
+  m_time++;
+  int leastRecentlyUsedWay = firstWay;
+  for (int i = firstWay; i < firstWay + k_numberOfWays; i++) {
+    if (m_keys[i] == key) {
+      m_numberOfHits++;
+      m_lastUses[i] = m_time;
+      return m_glyphs[i];
+    }
+    if (m_lastUses[i] < m_lastUses[leastRecentlyUsedWay]) {
+      leastRecentlyUsedWay = i;
+    }
+  }
+
+  m_numberOfMisses++;
+  const KDFont * font = KDFont::Font(size);
+  KDFont::GlyphBuffer glyphBuffer;
+  font->setGlyphGrayscalesForGlyphIndex(index, &glyphBuffer);
+  KDFont::RenderPalette palette = font->renderPalette(textColor, backgroundColor);
+  font->colorizeGlyphBuffer(&palette, &glyphBuffer);
+  int numberOfPixels = KDFont::GlyphWidth(size) * KDFont::GlyphHeight(size);
+  memcpy(m_glyphs[leastRecentlyUsedWay], glyphBuffer.colorBuffer(), numberOfPixels * sizeof(KDColor));
+  m_keys[leastRecentlyUsedWay] = key;
+  m_lastUses[leastRecentlyUsedWay] = m_time;
+  return m_glyphs[leastRecentlyUsedWay];
+}
+
+#endif
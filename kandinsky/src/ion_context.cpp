@@ -11,11 +11,25 @@ KDContext(KDPointZero, KDRectScreen)
 {
 }
 
+#if !PLATFORM_DEVICE
+KDIonContext::PushObserver KDIonContext::s_pushObserver = nullptr;
+#endif
+
 void KDIonContext::pushRect(KDRect rect, const KDColor * pixels) {
+#if !PLATFORM_DEVICE
+  if (s_pushObserver) {
+    s_pushObserver(rect);
+  }
+#endif
   Ion::Display::pushRect(rect, pixels);
 }
 
 void KDIonContext::pushRectUniform(KDRect rect, KDColor color) {
+#if !PLATFORM_DEVICE
+  if (s_pushObserver) {
+    s_pushObserver(rect);
+  }
+#endif
   Ion::Display::pushRectUniform(rect, color);
 }
 
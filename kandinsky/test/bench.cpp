@@ -0,0 +1,21 @@
+#include <quiz.h>
+#include <kandinsky/ion_context.h>
+
+QUIZ_BENCH(kandinsky_draw_string) {
+  KDContext * ctx = KDIonContext::SharedContext();
+  ctx->drawString("The quick brown fox jumps over the lazy dog", KDPoint(0, 0), KDFont::Size::Large);
+  ctx->drawString("0123456789+-*/()=<>", KDPoint(0, 30), KDFont::Size::Small, KDColorRed, KDColorWhite);
+}
+
+QUIZ_BENCH(kandinsky_blend_rect_with_mask) {
+  constexpr KDCoordinate k_width = 100;
+  constexpr KDCoordinate k_height = 20;
+  static uint8_t sMask[k_width * k_height];
+  for (int i = 0; i < k_width * k_height; i++) {
+    sMask[i] = i * 7;
+  }
+  KDColor workingBuffer[k_width * k_height];
+  KDContext * ctx = KDIonContext::SharedContext();
+  ctx->fillRectWithMask(KDRect(0, 0, k_width, k_height), KDColorRed, KDColorWhite, sMask, workingBuffer);
+  ctx->blendRectWithMask(KDRect(0, 0, k_width, k_height), KDColorBlue, sMask, workingBuffer);
+}
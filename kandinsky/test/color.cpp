@@ -84,3 +84,35 @@ QUIZ_CASE(kandinsky_color_hsv) {
     quiz_assert(conversionColor == dataColor);
   }
 }
+
+QUIZ_CASE(kandinsky_color_blend_span) {
+  // Spans of every length up to 19 cover the vectorized and remaining pixels
+  constexpr int k_maxLength = 19;
+  KDColor pixels[k_maxLength];
+  KDColor filledPixels[k_maxLength];
+  uint8_t alphas[k_maxLength];
+  uint32_t seed = 12345;
+  for (int n = 0; n < 2000; n++) {
+    int length = n % (k_maxLength + 1);
+    KDColor first = KDColor::RGB16(seed >> 16);
+    seed = seed * 1103515245 + 12345;
+    KDColor second = KDColor::RGB16(seed >> 16);
+    for (int i = 0; i < length; i++) {
+      seed = seed * 1103515245 + 12345;
+      pixels[i] = KDColor::RGB16(seed >> 16);
+      // Favor the special alphas 0 and 0xFF
+      alphas[i] = i % 3 == 0 ? 0xFF * (seed & 1) : seed >> 24;
+    }
+    for (int i = 0; i < length; i++) {
+      filledPixels[i] = pixels[i];
+    }
+    KDColor::BlendSpan(pixels, second, alphas, length);
+    for (int i = 0; i < length; i++) {
+      quiz_assert(pixels[i] == KDColor::Blend(filledPixels[i], second, alphas[i]));
+    }
+    KDColor::BlendSpan(filledPixels, first, second, alphas, length);
+    for (int i = 0; i < length; i++) {
+      quiz_assert(filledPixels[i] == KDColor::Blend(first, second, alphas[i]));
+    }
+  }
+}
@@ -0,0 +1,39 @@
+#include <kandinsky/glyph_cache.h>
+#include <quiz.h>
+
+#if KANDINSKY_GLYPH_CACHE_SIZE
+
+// hit is 1 for an expected cache hit, 0 for a miss and -1 when unpredictable
+static void assert_cached_glyph_is_rendered(KDFont::Size size, CodePoint c, KDColor textColor, KDColor backgroundColor, int hit = -1) {
+  KDGlyphCache * cache = KDGlyphCache::SharedCache();
+  const KDFont * font = KDFont::Font(size);
+  int numberOfHits = cache->numberOfHits();
+  const KDColor * glyph = cache->glyph(size, font->indexForCodePoint(c), textColor, backgroundColor);
+  quiz_assert(hit < 0 || cache->numberOfHits() == numberOfHits + hit);
+
+  KDFont::GlyphBuffer glyphBuffer;
+  font->setGlyphGrayscalesForCodePoint(c, &glyphBuffer);
+  KDFont::RenderPalette palette = font->renderPalette(textColor, backgroundColor);
+  font->colorizeGlyphBuffer(&palette, &glyphBuffer);
+  for (int i = 0; i < KDFont::GlyphWidth(size) * KDFont::GlyphHeight(size); i++) {
+    quiz_assert(glyph[i] == glyphBuffer.colorBuffer()[i]);
+  }
+}
+
+QUIZ_CASE(kandinsky_glyph_cache) {
+  KDGlyphCache::SharedCache()->reset();
+  assert_cached_glyph_is_rendered(KDFont::Size::Large, 'a', KDColorBlack, KDColorWhite, 0);
+  assert_cached_glyph_is_rendered(KDFont::Size::Large, 'a', KDColorBlack, KDColorWhite, 1);
+  assert_cached_glyph_is_rendered(KDFont::Size::Small, 'a', KDColorBlack, KDColorWhite, 0);
+  assert_cached_glyph_is_rendered(KDFont::Size::Large, 'a', KDColorRed, KDColorWhite, 0);
+  assert_cached_glyph_is_rendered(KDFont::Size::Large, 'a', KDColorRed, KDColorBlack, 0);
+  assert_cached_glyph_is_rendered(KDFont::Size::Small, 'a', KDColorBlack, KDColorWhite, 1);
+
+  // Filling the cache evicts glyphs but keeps rendering them right
+  for (CodePoint c = '0'; c <= 'z'; c = c + 1) {
+    assert_cached_glyph_is_rendered(KDFont::Size::Small, c, KDColorBlack, KDColorWhite);
+  }
+  KDGlyphCache::SharedCache()->reset();
+}
+
+#endif
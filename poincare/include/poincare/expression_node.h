@@ -149,6 +149,9 @@ public:
 
   /* Poor man's RTTI */
   virtual Type type() const = 0;
+#if POINCARE_TREE_STATS
+  int statisticsBucket() const override { return static_cast<int>(type()); }
+#endif
 
   /* Properties */
   virtual TrinaryBoolean isPositive(Context * context) const { return TrinaryBoolean::Unknown; }
@@ -51,6 +51,21 @@ public:
     exp -= exponentOffset();
     return exp;
   }
+  /* powerOfTen returns std::pow(10, exponent), in the type std::pow would
+   * return. Exactly representable powers of ten are read from a table, which
+   * gives the same value without computing the power. */
+  static auto powerOfTen(int exponent) -> decltype(std::pow(static_cast<T>(10.0), exponent)) {
+    using PowerType = decltype(std::pow(static_cast<T>(10.0), exponent));
+    constexpr int k_maxExactExponent = sizeof(PowerType) == sizeof(float) ? 10 : 22;
+    constexpr static double k_powersOfTen[] = {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    if (exponent < 0 || exponent > k_maxExactExponent) {
+      return std::pow(static_cast<T>(10.0), exponent);
+    }
+    return static_cast<PowerType>(k_powersOfTen[exponent]);
+  }
   static int exponentBase10(T f) {
     constexpr T k_log10base2 = 3.321928094887362347870319429489390175864831393024580612054;
     if (f == static_cast<T>(0.0)) {
@@ -68,7 +83,7 @@ public:
      * in -0.31 < x < 1, we get:
      * e2 = [e1/log(10,2)]  or e2 = [e1/log(10,2)]-1 depending on m1. */
     int exponentBase10 = std::round(exponentBase2/k_log10base2);
-    if (std::pow(static_cast<T>(10.0), exponentBase10) > std::fabs(f)) {
+    if (powerOfTen(exponentBase10) > std::fabs(f)) {
       exponentBase10--;
     }
     return exponentBase10;
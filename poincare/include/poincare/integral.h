@@ -60,7 +60,7 @@ private:
     Expression integrandNearB;
   };
   Expression rewriteIntegrandNear(Expression bound, const ReductionContext& reductionContext) const;
-  template<typename T> T integrand(T x, Substitution<T> substitution, const ApproximationContext& approximationContext) const;
+  template<typename T> void integrandValues(const T * x, T * values, int n, Substitution<T> substitution, const ApproximationContext& approximationContext) const;
   template<typename T> T integrandNearBound(T x, T xc, AlternativeIntegrand alternativeIntegrand, const ApproximationContext& approximationContext) const;
   template<typename T> DetailedResult<T> tanhSinhQuadrature(int level, AlternativeIntegrand alternativeIntegrand, const ApproximationContext& approximationContext) const;
   template<typename T> DetailedResult<T> kronrodGaussQuadrature(T a, T b, Substitution<T> substitution, const ApproximationContext& approximationContext) const;
@@ -55,23 +55,30 @@ public:
   // Constructor
   LayoutNode() :
     TreeNode(),
-    m_frame(KDRectZero),
-    m_baseline(0),
+    m_absoluteOrigin(KDPointZero),
+#if POINCARE_LAYOUT_MEASURES_PER_FONT
+    m_sizes{KDSizeZero, KDSizeZero},
+    m_baselines{0, 0},
+#else
+    m_sizes{KDSizeZero},
+    m_baselines{0},
+#endif
     m_flags({
-      .m_baselined = false,
       .m_positioned = false,
-      .m_sized = false,
       .m_margin = false,
       .m_lockMargin = false,
-      .m_baselineFontSize = KDFont::Size::Small,
       .m_positionFontSize = KDFont::Size::Small,
-      .m_sizeFontSize = KDFont::Size::Small,
+      .m_sized = 0,
+      .m_baselined = 0,
     })
   {
   }
 
   /* Poor man's RTTI */
   virtual Type type() const = 0;
+#if POINCARE_TREE_STATS
+  int statisticsBucket() const override { return k_layoutStatisticsBucketOffset + static_cast<int>(type()); }
+#endif
 
   // Comparison
   bool isIdenticalTo(Layout l, bool makeEditable = false);
@@ -81,13 +88,20 @@ public:
   KDPoint absoluteOrigin(KDFont::Size font) { return absoluteOriginWithMargin(font).translatedBy(KDPoint(leftMargin(), 0)); }
   KDSize layoutSize(KDFont::Size font);
   KDCoordinate baseline(KDFont::Size font);
-  void setMargin(bool hasMargin) { m_flags.m_margin = hasMargin; }
+  void setMargin(bool hasMargin);
   void lockMargin(bool lock) { m_flags.m_lockMargin = lock; }
   int leftMargin() const { return m_flags.m_margin ? Escher::Metric::OperatorHorizontalMargin : 0; }
   bool marginIsLocked() const { return m_flags.m_lockMargin; }
 
-  //TODO: invalid cache when tempering with hierarchy
   virtual void invalidAllSizesPositionsAndBaselines();
+  /* Sizes and baselines only depend on the subtree of a layout, and on the
+   * siblings of the children of an horizontal layout (see
+   * VerticalOffsetLayoutNode). When a layout is edited, only the memoized
+   * sizes of the layouts on the path to the root are dropped. Positions are
+   * cheap to recompute from memoized sizes and are dropped for the whole
+   * tree. */
+  void invalidSizesPositionsAndBaselinesUpToRoot();
+  void didChangeChildren() override { invalidSizesPositionsAndBaselinesUpToRoot(); }
   int serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode = Preferences::PrintFloatMode::Decimal, int numberOfSignificantDigits = 0) const override { assert(false); return 0; }
 
   // Tree
@@ -193,24 +207,38 @@ private:
     bool forSelection);
   virtual void render(KDContext * ctx, KDPoint p, KDFont::Size font, KDColor expressionColor, KDColor backgroundColor, Layout * selectionStart = nullptr, Layout * selectionEnd = nullptr, KDColor selectionColor = KDColorRed) = 0;
   void changeGraySquaresOfAllGridRelatives(bool add, bool ancestors, bool * changedSquares);
-
-  KDRect m_frame;
-  /* m_baseline is the signed vertical distance from the top of the layout to
+  void invalidSizeAndBaseline() { m_flags.m_sized = 0; m_flags.m_baselined = 0; }
+  void invalidAllPositions();
+  static uint8_t FontBit(KDFont::Size font) { return 1 << static_cast<uint8_t>(font); }
+  static int FontSlot(KDFont::Size font) { return k_numberOfMemoizedFonts > 1 ? static_cast<int>(font) : 0; }
+
+  /* A layout can be measured in both font sizes (see
+   * LayoutCursor::middleLeftPoint). Memoizing sizes and baselines for both
+   * takes 6 more bytes per layout node, which the device pool cannot afford:
+   * there, the measures of the last font replace the other ones. */
+  constexpr static int k_numberOfFontSizes = 2;
+#if POINCARE_LAYOUT_MEASURES_PER_FONT
+  constexpr static int k_numberOfMemoizedFonts = k_numberOfFontSizes;
+#else
+  constexpr static int k_numberOfMemoizedFonts = 1;
+#endif
+  KDPoint m_absoluteOrigin;
+  KDSize m_sizes[k_numberOfMemoizedFonts];
+  /* A baseline is the signed vertical distance from the top of the layout to
    * the fraction bar of an hypothetical fraction sibling layout. If the top of
    * the layout is under that bar, the baseline is negative. */
-  KDCoordinate m_baseline;
+  KDCoordinate m_baselines[k_numberOfMemoizedFonts];
   /* Squash multiple bool member variables into a packed struct. Taking
    * advantage of LayoutNode's data structure having room for many more booleans
    */
   struct Flags {
-    bool m_baselined: 1;
     bool m_positioned: 1;
-    bool m_sized: 1;
     bool m_margin: 1;
     bool m_lockMargin: 1;
-    KDFont::Size m_baselineFontSize: 1;
     KDFont::Size m_positionFontSize: 1;
-    KDFont::Size m_sizeFontSize: 1;
+    // One bit per font size
+    uint8_t m_sized: k_numberOfFontSizes;
+    uint8_t m_baselined: k_numberOfFontSizes;
   };
   Flags m_flags;
 };
@@ -26,6 +26,9 @@ protected:
     return approximateFirstChildWithArgument(x, approximationContext).toScalar();
   }
   template<typename T> Evaluation<T> approximateExpressionWithArgument(ExpressionNode * child, T x, const ApproximationContext& approximationContext) const;
+  /* Approximate the first child at each of the n arguments of x, sharing the
+   * variable context between the evaluations. */
+  template<typename T> void firstChildScalarValuesForArguments(const T * x, T * values, int n, const ApproximationContext& approximationContext) const;
 
 };
 
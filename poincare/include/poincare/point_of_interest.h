@@ -34,7 +34,8 @@ private:
   bool m_inverted;
   uint8_t m_subCurveIndex;
 };
-static_assert(sizeof(PointOfInterestNode) <= 40, "merge m_subCurveIndex and m_data if you need more than one byte");
+// Larger tree pools use 32-bit node identifiers, which pads the TreeNode header
+static_assert(sizeof(PointOfInterestNode) <= 40 + 4 * (sizeof(TreeNode::Identifier) - sizeof(uint16_t)), "merge m_subCurveIndex and m_data if you need more than one byte");
 
 class PointOfInterest : public TreeHandle {
 public:
@@ -0,0 +1,33 @@
+#ifndef POINCARE_TOMBSTONE_NODE_H
+#define POINCARE_TOMBSTONE_NODE_H
+
+#include "tree_node.h"
+
+namespace Poincare {
+
+/* A TombstoneNode takes the place of a node freed in the middle of the pool.
+ * It keeps the size of the freed node so that the pool can still be walked,
+ * and is swept away by the next compaction. It has no identifier. */
+
+class TombstoneNode final : public TreeNode {
+public:
+  constexpr static size_t k_maxSize = UINT16_MAX;
+  TombstoneNode(size_t size) : TreeNode(), m_size(size) { assert(size <= k_maxSize); }
+  static bool IsTombstone(const TreeNode * node) { return node->identifier() == NoNodeIdentifier; }
+
+  // TreeNode
+  int numberOfChildren() const override { return 0; }
+  size_t size() const override { return m_size; }
+#if POINCARE_TREE_LOG
+  void logNodeName(std::ostream & stream) const override {
+    stream << "Tombstone";
+  }
+#endif
+
+private:
+  uint16_t m_size;
+};
+
+}
+
+#endif
@@ -59,7 +59,7 @@ public:
   /* Clone */
   TreeHandle clone() const;
 
-  uint16_t identifier() const { return m_identifier; }
+  TreeNode::Identifier identifier() const { return m_identifier; }
   TreeNode * node() const;
   bool wasErasedByException() const {
     return hasNode(m_identifier) && node() == nullptr;
@@ -85,7 +85,7 @@ public:
   int indexOfChild(TreeHandle t) const;
   TreeHandle parent() const;
   TreeHandle childAtIndex(int i) const;
-  void setParentIdentifier(uint16_t id) { node()->setParentIdentifier(id); }
+  void setParentIdentifier(TreeNode::Identifier id) { node()->setParentIdentifier(id); }
   void deleteParentIdentifier() { node()->deleteParentIdentifier(); }
   void deleteParentIdentifierInChildren() { node()->deleteParentIdentifierInChildren(); }
   void incrementNumberOfChildren(int increment = 1) { node()->incrementNumberOfChildren(increment); }
@@ -120,7 +120,7 @@ protected:
   /* Constructor */
   TreeHandle(const TreeNode * node);
   // Un-inlining this constructor actually inscreases the firmware size
-  TreeHandle(uint16_t nodeIndentifier = TreeNode::NoNodeIdentifier) : m_identifier(nodeIndentifier) {
+  TreeHandle(TreeNode::Identifier nodeIndentifier = TreeNode::NoNodeIdentifier) : m_identifier(nodeIndentifier) {
     if (hasNode(nodeIndentifier)) {
       node()->retain();
     }
@@ -134,10 +134,10 @@ protected:
 
   static TreeHandle BuildWithGhostChildren(TreeNode * node);
 
-  void setIdentifierAndRetain(uint16_t newId);
+  void setIdentifierAndRetain(TreeNode::Identifier newId);
   void setTo(const TreeHandle & tr);
 
-  static bool hasNode(uint16_t identifier) { return TreeNode::IsValidIdentifier(identifier); }
+  static bool hasNode(TreeNode::Identifier identifier) { return TreeNode::IsValidIdentifier(identifier); }
 
   /* Hierarchy operations */
   // Add
@@ -147,7 +147,7 @@ protected:
   void removeChildInPlace(TreeHandle t, int childNumberOfChildren);
   void removeChildrenInPlace(int currentNumberOfChildren);
 
-  uint16_t m_identifier;
+  TreeNode::Identifier m_identifier;
 
 private:
   template <class U>
@@ -156,7 +156,7 @@ private:
   void detachFromParent();
   // Add ghost children on layout construction
   void buildGhostChildren();
-  void release(uint16_t identifier);
+  void release(TreeNode::Identifier identifier);
 };
 
 }
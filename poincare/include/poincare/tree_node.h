@@ -37,34 +37,53 @@ typedef uint32_t AlignedNodeBuffer;
 #endif
 constexpr static int ByteAlignment = sizeof(AlignedNodeBuffer);
 
+/* The TreePool buffer is 32KB on the device. Other platforms can be built with
+ * a larger pool by defining POINCARE_TREE_POOL_SIZE. */
+#if !defined(POINCARE_TREE_POOL_SIZE) || PLATFORM_DEVICE
+#undef POINCARE_TREE_POOL_SIZE
+#define POINCARE_TREE_POOL_SIZE 32768
+#endif
+constexpr static int TreePoolBufferSize = POINCARE_TREE_POOL_SIZE;
+
+/* Node identifiers and node offsets in the pool are stored on 16 bits as long
+ * as the pool is small enough, and on 32 bits otherwise. */
+template<bool Wide>
+struct TreePoolIndex {
+  typedef uint16_t Type;
+};
+template<>
+struct TreePoolIndex<true> {
+  typedef uint32_t Type;
+};
+typedef TreePoolIndex<(TreePoolBufferSize/ByteAlignment >= UINT16_MAX)>::Type TreePoolIndexType;
+
 class TreeNode {
   friend class TreePool;
 public:
-  constexpr static uint16_t NoNodeIdentifier = -2;
-  constexpr static uint16_t OverflowIdentifier = TreeNode::NoNodeIdentifier + 1; // Used for Integer
+  typedef TreePoolIndexType Identifier;
+  constexpr static Identifier NoNodeIdentifier = -2;
+  constexpr static Identifier OverflowIdentifier = TreeNode::NoNodeIdentifier + 1; // Used for Integer
 
   // Constructor and destructor
   virtual ~TreeNode() {}
   typedef TreeNode * (* const Initializer)(void *);
 
   // Attributes
-  void setParentIdentifier(uint16_t parentID) { m_parentIdentifier = parentID; }
+  void setParentIdentifier(Identifier parentID) { m_parentIdentifier = parentID; }
   void deleteParentIdentifier() { m_parentIdentifier = NoNodeIdentifier; }
   virtual size_t size() const = 0;
-  uint16_t identifier() const { return m_identifier; }
+  Identifier identifier() const { return m_identifier; }
   int retainCount() const { return m_referenceCounter; }
   size_t deepSize(int realNumberOfChildren) const;
 
   // Ghost
-#if ASSERTIONS
   virtual bool isGhost() const { return false; }
-#endif
 
   // Node operations
   void setReferenceCounter(int refCount) { m_referenceCounter = refCount; }
   void retain() { m_referenceCounter++; }
   void release(int currentNumberOfChildren);
-  void rename(uint16_t identifier, bool unregisterPreviousIdentifier, bool skipChildrenUpdate = false);
+  void rename(Identifier identifier, bool unregisterPreviousIdentifier, bool skipChildrenUpdate = false);
 
   // Hierarchy
   TreeNode * parent() const;
@@ -87,6 +106,8 @@ public:
   }
   // AddChild collateral effect
   virtual void didChangeArity(int newNumberOfChildren) {}
+  // Called by TreeHandle after any in place modification of the children
+  virtual void didChangeChildren() {}
 
   // Serialization
   // Return the number of chars written, without the null-terminating char.
@@ -180,7 +201,16 @@ public:
   void log() { log(std::cout); std::cout << std::endl; }
 #endif
 
-  static bool IsValidIdentifier(uint16_t id) { return id < NoNodeIdentifier; }
+  static bool IsValidIdentifier(Identifier id) { return id < NoNodeIdentifier; }
+
+#if POINCARE_TREE_STATS
+  /* Bucket of the node in the TreePool statistics histograms. Expression and
+   * layout nodes are counted per type, other nodes all together. */
+  constexpr static int k_layoutStatisticsBucketOffset = 256;
+  constexpr static int k_otherStatisticsBucket = 2*k_layoutStatisticsBucketOffset;
+  constexpr static int k_numberOfStatisticsBuckets = k_otherStatisticsBucket + 1;
+  virtual int statisticsBucket() const { return k_otherStatisticsBucket; }
+#endif
 
 protected:
   TreeNode() :
@@ -193,9 +223,9 @@ private:
   void updateParentIdentifierInChildren() const {
     changeParentIdentifierInChildren(m_identifier);
   }
-  void changeParentIdentifierInChildren(uint16_t id) const;
-  uint16_t m_identifier;
-  uint16_t m_parentIdentifier;
+  void changeParentIdentifierInChildren(Identifier id) const;
+  Identifier m_identifier;
+  Identifier m_parentIdentifier;
   int8_t m_referenceCounter;
 };
 
@@ -3,10 +3,11 @@
 
 #include "tree_node.h"
 #include <poincare/ghost_node.h>
+#include <poincare/tombstone_node.h>
 #include <stddef.h>
 #include <string.h>
 #include <new>
-#if POINCARE_TREE_LOG
+#if POINCARE_TREE_LOG || POINCARE_TREE_STATS
 #include <iostream>
 #endif
 
@@ -32,14 +33,18 @@ public:
 #endif
  }
 
-  TreePool() : m_cursor(buffer()) {}
+  TreePool() : m_cursor(buffer()), m_firstTombstone(nullptr), m_lastTombstone(nullptr), m_numberOfDeadBytes(0), m_numberOfDeadBytesLeftBySweep(0), m_lastSweepStart(nullptr) {
+#if POINCARE_TREE_STATS
+    resetStatistics();
+#endif
+  }
 
   char * cursor() const { return m_cursor; }
 
   // Node
-  TreeNode * node(uint16_t identifier) const {
+  TreeNode * node(TreeNode::Identifier identifier) const {
     assert(TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes);
-    if (m_nodeForIdentifierOffset[identifier] != UINT16_MAX) {
+    if (m_nodeForIdentifierOffset[identifier] != k_noNodeOffset) {
       return const_cast<TreeNode *>(reinterpret_cast<const TreeNode *>(m_alignedBuffer + m_nodeForIdentifierOffset[identifier]));
     }
     return nullptr;
@@ -63,10 +68,38 @@ public:
 #endif
   int numberOfNodes() const;
 
+#if POINCARE_TREE_STATS
+  struct Statistics {
+    uint32_t numberOfAllocations;
+    uint32_t numberOfDeallocations;
+    // Bytes moved around by moveNodes and by compactions
+    uint32_t numberOfMovedBytes;
+    // High-water mark of the used part of the buffer
+    uint32_t peakNumberOfBytes;
+    // Allocations that did not fit and raised an exception
+    uint32_t numberOfOverflows;
+    uint32_t allocationsPerBucket[TreeNode::k_numberOfStatisticsBuckets];
+    uint32_t deallocationsPerBucket[TreeNode::k_numberOfStatisticsBuckets];
+  };
+  const Statistics * statistics() const { return &m_statistics; }
+  void resetStatistics();
+  void recordAllocation(const TreeNode * node) { m_statistics.allocationsPerBucket[node->statisticsBucket()]++; }
+  void statisticsLog(std::ostream & stream, bool withHistograms = true) const;
+#endif
+
 private:
-  constexpr static int BufferSize = 32768;
+  typedef TreePoolIndexType NodeOffset;
+  constexpr static int BufferSize = TreePoolBufferSize;
   constexpr static int MaxNumberOfNodes = BufferSize/sizeof(TreeNode);
   constexpr static int k_maxNodeOffset = BufferSize/ByteAlignment;
+  constexpr static NodeOffset k_noNodeOffset = static_cast<NodeOffset>(-1);
+#if PLATFORM_DEVICE
+  static_assert(sizeof(NodeOffset) == sizeof(uint16_t) && sizeof(TreeNode::Identifier) == sizeof(uint16_t), "The device pool should keep 16-bit identifier and offset tables.");
+#endif
+  /* Nodes freed in the middle of the pool are left as tombstones until this
+   * many bytes are dead. */
+  constexpr static size_t k_maxNumberOfDeadBytes = BufferSize/16;
+  static_assert(sizeof(TombstoneNode) <= sizeof(GhostNode), "A tombstone must fit in the smallest node.");
 
   static TreePool * SharedStaticPool;
 #if ASSERTIONS
@@ -128,24 +161,28 @@ private:
 
   // Pool memory
   void dealloc(TreeNode * ptr, size_t size);
+  void compactFromNode(TreeNode * node);
+  void dropTombstonesEndingPool();
+  TreeNode * firstTombstoneOfRun(TreeNode * tombstone, size_t * numberOfDeadBytesBelow = nullptr) const;
+  TreeNode * lastTombstoneBelow(TreeNode * node) const;
   void moveNodes(TreeNode * destination, TreeNode * source, size_t moveLength);
 
   // Identifiers
-  uint16_t generateIdentifier() { return m_identifiers.pop(); }
-  void freeIdentifier(uint16_t identifier);
+  TreeNode::Identifier generateIdentifier() { return m_identifiers.pop(); }
+  void freeIdentifier(TreeNode::Identifier identifier);
 
   class IdentifierStack final {
   public:
     IdentifierStack() { reset(); }
     void reset();
-    void push(uint16_t i);
-    uint16_t pop();
-    void remove(uint16_t j);
-    void resetNodeForIdentifierOffsets(uint16_t * nodeForIdentifierOffset) const;
+    void push(TreeNode::Identifier i);
+    TreeNode::Identifier pop();
+    void remove(TreeNode::Identifier j);
+    void resetNodeForIdentifierOffsets(NodeOffset * nodeForIdentifierOffset) const;
   private:
-    uint16_t m_currentIndex;
-    uint16_t m_availableIdentifiers[MaxNumberOfNodes];
-    static_assert(MaxNumberOfNodes < INT16_MAX && sizeof(m_availableIdentifiers[0] == sizeof(uint16_t)), "Tree node identifiers do not have the right data size.");
+    TreeNode::Identifier m_currentIndex;
+    TreeNode::Identifier m_availableIdentifiers[MaxNumberOfNodes];
+    static_assert(MaxNumberOfNodes < TreeNode::NoNodeIdentifier, "Tree node identifiers do not have the right data size.");
   };
 
   void freePoolFromNode(TreeNode * firstNodeToDiscard);
@@ -154,10 +191,20 @@ private:
   const char * constBuffer() const { return reinterpret_cast<const char *>(m_alignedBuffer); }
   AlignedNodeBuffer m_alignedBuffer[BufferSize/ByteAlignment];
   char * m_cursor;
+  TreeNode * m_firstTombstone;
+  // Highest tombstone, adjacent freed nodes are merged into it
+  TreeNode * m_lastTombstone;
+  size_t m_numberOfDeadBytes;
+  // Dead bytes below the node the last sweep started from
+  size_t m_numberOfDeadBytesLeftBySweep;
+  TreeNode * m_lastSweepStart;
   IdentifierStack m_identifiers;
-  uint16_t m_nodeForIdentifierOffset[MaxNumberOfNodes];
-  static_assert(k_maxNodeOffset < UINT16_MAX && sizeof(m_nodeForIdentifierOffset[0]) == sizeof(uint16_t),
-        "The tree pool node offsets in m_nodeForIdentifierOffset cannot be written with the chosen data size (uint16_t)");
+  NodeOffset m_nodeForIdentifierOffset[MaxNumberOfNodes];
+#if POINCARE_TREE_STATS
+  Statistics m_statistics;
+#endif
+  static_assert(k_maxNodeOffset < k_noNodeOffset,
+        "The tree pool node offsets in m_nodeForIdentifierOffset cannot be written with the chosen data size");
 };
 
 }
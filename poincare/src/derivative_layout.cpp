@@ -304,6 +304,7 @@ KDCoordinate DerivativeLayoutNode::parenthesesWidth(KDFont::Size font) {
 void DerivativeLayoutNode::setVariableSlot(VariableSlot variableSlot, bool * shouldRecomputeLayout) {
   if (m_variableSlot != variableSlot) {
     m_variableSlot = variableSlot;
+    invalidSizesPositionsAndBaselinesUpToRoot();
     *shouldRecomputeLayout = true;
   }
 }
@@ -311,6 +312,7 @@ void DerivativeLayoutNode::setVariableSlot(VariableSlot variableSlot, bool * sho
 void HigherOrderDerivativeLayoutNode::setOrderSlot(OrderSlot orderSlot, bool * shouldRecomputeLayout) {
   if (m_orderSlot != orderSlot) {
     m_orderSlot = orderSlot;
+    invalidSizesPositionsAndBaselinesUpToRoot();
     *shouldRecomputeLayout = true;
   }
 }
@@ -9,7 +9,18 @@ void EmptyLayoutNode::setVisible(bool visible) {
   if (m_visibility == Visibility::Never) {
     return;
   }
-  m_visibility = visible ? Visibility::On : Visibility::Off;
+  Visibility visibility = visible ? Visibility::On : Visibility::Off;
+  if (m_visibility != visibility) {
+    m_visibility = visibility;
+    invalidSizesPositionsAndBaselinesUpToRoot();
+  }
+}
+
+void EmptyLayoutNode::enableToBeVisible() {
+  if (m_visibility != Visibility::On) {
+    m_visibility = Visibility::On;
+    invalidSizesPositionsAndBaselinesUpToRoot();
+  }
 }
 
 void EmptyLayoutNode::deleteBeforeCursor(LayoutCursor * cursor) {
@@ -469,6 +469,7 @@ void GridLayout::setDimensions(int rows, int columns) {
   assert(rows * columns == numberOfChildren());
   setNumberOfRows(rows);
   setNumberOfColumns(columns);
+  node()->invalidSizesPositionsAndBaselinesUpToRoot();
 }
 
 }
@@ -140,32 +140,64 @@ Evaluation<T> IntegralNode::templatedApproximate(const ApproximationContext& app
   return Complex<T>::Builder(result);
 }
 
+/* The integrand is evaluated at a whole batch of abscissae at once, so that
+ * the quadrature rules share the variable context between their nodes. */
 template<typename T>
-T IntegralNode::integrand(T x, Substitution<T> substitution, const ApproximationContext& approximationContext) const {
-  switch (substitution.type) {
-  case Substitution<T>::Type::None:
-    return firstChildScalarValueForArgument(x, approximationContext);
-  case Substitution<T>::Type::LeftOpen:
-  {
-    T z = 1.0 / (x + 1.0);
-    T arg = substitution.originB - (2.0 * z - 1.0);
-    return firstChildScalarValueForArgument(arg, approximationContext) * z * z;
-  }
-  case Substitution<T>::Type::RightOpen:
-  {
-    T z = 1.0 / (x + 1);
-    T arg = 2.0 * z + substitution.originA - 1.0;
-    return firstChildScalarValueForArgument(arg, approximationContext) * z * z;
-  }
-  default:
-  {
-    assert(substitution.type == Substitution<T>::Type::RealLine);
-    T x2 = x * x;
-    T inv = 1.0 / (1.0 - x2);
-    T w = (1.0 + x2) * inv * inv;
-    T arg = x * inv;
-    return firstChildScalarValueForArgument(arg, approximationContext) * w;
+void IntegralNode::integrandValues(const T * x, T * values, int n, Substitution<T> substitution, const ApproximationContext& approximationContext) const {
+  constexpr int k_maxNumberOfValues = 21;
+  assert(n <= k_maxNumberOfValues);
+  T arguments[k_maxNumberOfValues];
+  for (int i = 0; i < n; i++) {
+    switch (substitution.type) {
+    case Substitution<T>::Type::None:
+      arguments[i] = x[i];
+      break;
+    case Substitution<T>::Type::LeftOpen:
+    {
+      T z = 1.0 / (x[i] + 1.0);
+      arguments[i] = substitution.originB - (2.0 * z - 1.0);
+      break;
+    }
+    case Substitution<T>::Type::RightOpen:
+    {
+      T z = 1.0 / (x[i] + 1);
+      arguments[i] = 2.0 * z + substitution.originA - 1.0;
+      break;
+    }
+    default:
+    {
+      assert(substitution.type == Substitution<T>::Type::RealLine);
+      T x2 = x[i] * x[i];
+      T inv = 1.0 / (1.0 - x2);
+      arguments[i] = x[i] * inv;
+    }
+    }
   }
+  firstChildScalarValuesForArguments(arguments, values, n, approximationContext);
+  for (int i = 0; i < n; i++) {
+    switch (substitution.type) {
+    case Substitution<T>::Type::None:
+      break;
+    case Substitution<T>::Type::LeftOpen:
+    {
+      T z = 1.0 / (x[i] + 1.0);
+      values[i] = values[i] * z * z;
+      break;
+    }
+    case Substitution<T>::Type::RightOpen:
+    {
+      T z = 1.0 / (x[i] + 1);
+      values[i] = values[i] * z * z;
+      break;
+    }
+    default:
+    {
+      T x2 = x[i] * x[i];
+      T inv = 1.0 / (1.0 - x2);
+      T w = (1.0 + x2) * inv * inv;
+      values[i] = values[i] * w;
+    }
+    }
   }
 }
 
@@ -332,23 +364,29 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, S
   errorResult.integral = NAN;
   errorResult.absoluteError = 0;
 
-  T gaussIntegral = 0;
-  T fCenter = integrand(center ,substitution, approximationContext);
-  if (std::isnan(fCenter)) {
-    return errorResult;
-  }
-  T kronrodIntegral = wKronrod[10] * fCenter;
-  T absKronrodIntegral = std::fabs(kronrodIntegral);
+  // Abscissae are ordered as center, center-xDelta(j), center+xDelta(j)
+  T abscissae[21];
+  T values[21];
+  abscissae[0] = center;
   for (int j = 0; j < 10; j++) {
     T xDelta = halfLength * x[j];
-    T fval1 = integrand(center - xDelta, substitution, approximationContext);
-    if (std::isnan(fval1)) {
-      return errorResult;
-    }
-    T fval2 = integrand(center + xDelta, substitution, approximationContext);
-    if (std::isnan(fval2)) {
+    abscissae[2*j+1] = center - xDelta;
+    abscissae[2*j+2] = center + xDelta;
+  }
+  integrandValues(abscissae, values, 21, substitution, approximationContext);
+  for (int i = 0; i < 21; i++) {
+    if (std::isnan(values[i])) {
       return errorResult;
     }
+  }
+
+  T gaussIntegral = 0;
+  T fCenter = values[0];
+  T kronrodIntegral = wKronrod[10] * fCenter;
+  T absKronrodIntegral = std::fabs(kronrodIntegral);
+  for (int j = 0; j < 10; j++) {
+    T fval1 = values[2*j+1];
+    T fval2 = values[2*j+2];
     fv1[j] = fval1;
     fv2[j] = fval2;
     T fsum = fval1 + fval2;
@@ -54,44 +54,80 @@ KDPoint LayoutNode::absoluteOriginWithMargin(KDFont::Size font) {
   LayoutNode * p = parent();
   if (!m_flags.m_positioned || m_flags.m_positionFontSize != font) {
     if (p != nullptr) {
-      m_frame.setOrigin(p->absoluteOrigin(font).translatedBy(p->positionOfChild(this, font)));
+      m_absoluteOrigin = p->absoluteOrigin(font).translatedBy(p->positionOfChild(this, font));
     } else {
-      m_frame.setOrigin(KDPointZero);
+      m_absoluteOrigin = KDPointZero;
     }
     m_flags.m_positioned = true;
     m_flags.m_positionFontSize = font;
   }
-  return m_frame.origin();
+  return m_absoluteOrigin;
 }
 
 KDSize LayoutNode::layoutSize(KDFont::Size font) {
-  if (!m_flags.m_sized || m_flags.m_sizeFontSize != font) {
+  int slot = FontSlot(font);
+  if (!(m_flags.m_sized & FontBit(font))) {
     KDSize size = computeSize(font);
-    m_frame.setSize(KDSize(size.width() + leftMargin(), size.height()));
-    m_flags.m_sized = true;
-    m_flags.m_sizeFontSize = font;
+    m_sizes[slot] = KDSize(size.width() + leftMargin(), size.height());
+    // The measures of the fonts sharing the slot are overwritten
+    m_flags.m_sized = (k_numberOfMemoizedFonts > 1 ? m_flags.m_sized : 0) | FontBit(font);
   }
-  return m_frame.size();
+  return m_sizes[slot];
 }
 
 KDCoordinate LayoutNode::baseline(KDFont::Size font) {
-  if (!m_flags.m_baselined || m_flags.m_baselineFontSize != font) {
-    m_baseline = computeBaseline(font);
-    m_flags.m_baselined = true;
-    m_flags.m_baselineFontSize = font;
+  int slot = FontSlot(font);
+  if (!(m_flags.m_baselined & FontBit(font))) {
+    m_baselines[slot] = computeBaseline(font);
+    m_flags.m_baselined = (k_numberOfMemoizedFonts > 1 ? m_flags.m_baselined : 0) | FontBit(font);
+  }
+  return m_baselines[slot];
+}
+
+void LayoutNode::setMargin(bool hasMargin) {
+  if (m_flags.m_margin != hasMargin) {
+    m_flags.m_margin = hasMargin;
+    invalidSizesPositionsAndBaselinesUpToRoot();
   }
-  return m_baseline;
 }
 
 void LayoutNode::invalidAllSizesPositionsAndBaselines() {
-  m_flags.m_sized = false;
+  invalidSizeAndBaseline();
   m_flags.m_positioned = false;
-  m_flags.m_baselined = false;
   for (LayoutNode * l : children()) {
     l->invalidAllSizesPositionsAndBaselines();
   }
 }
 
+void LayoutNode::invalidSizesPositionsAndBaselinesUpToRoot() {
+  LayoutNode * l = this;
+  LayoutNode * r = this;
+  while (l != nullptr) {
+    l->invalidSizeAndBaseline();
+    if (l->type() == Type::HorizontalLayout) {
+      for (LayoutNode * c : l->children()) {
+        /* Children may temporarily be ghosts while the tree is being
+         * modified. */
+        if (!c->isGhost()) {
+          c->invalidSizeAndBaseline();
+        }
+      }
+    }
+    r = l;
+    l = l->parent();
+  }
+  r->invalidAllPositions();
+}
+
+void LayoutNode::invalidAllPositions() {
+  m_flags.m_positioned = false;
+  for (LayoutNode * l : children()) {
+    if (!l->isGhost()) {
+      l->invalidAllPositions();
+    }
+  }
+}
+
 // Tree navigation
 LayoutCursor LayoutNode::equivalentCursor(LayoutCursor * cursor) {
   // Only HorizontalLayout may have no parent, and it overloads this method
@@ -289,8 +325,10 @@ void LayoutNode::scoreCursorInDescendantsVertically (
 {
   LayoutCursor::Position * castedResultPosition = static_cast<LayoutCursor::Position *>(resultPosition);
   KDPoint cursorMiddleLeft = cursor->middleLeftPoint();
-  bool layoutIsUnderOrAbove = direction == VerticalDirection::Up ? m_frame.isAbove(cursorMiddleLeft) : m_frame.isUnder(cursorMiddleLeft);
-  bool layoutContains = m_frame.contains(cursorMiddleLeft);
+  // Frame in the font of LayoutCursor::middleLeftPoint
+  KDRect frame(absoluteOriginWithMargin(KDFont::Size::Large), layoutSize(KDFont::Size::Large));
+  bool layoutIsUnderOrAbove = direction == VerticalDirection::Up ? frame.isAbove(cursorMiddleLeft) : frame.isUnder(cursorMiddleLeft);
+  bool layoutContains = frame.contains(cursorMiddleLeft);
 
   if (layoutIsUnderOrAbove) {
     // Check the distance to a Left cursor.
@@ -62,6 +62,19 @@ Evaluation<T> ParameteredExpressionNode::approximateExpressionWithArgument(Expre
   return expression->approximate(T(), childContext);
 }
 
+template<typename T>
+void ParameteredExpressionNode::firstChildScalarValuesForArguments(const T * x, T * values, int n, const ApproximationContext& approximationContext) const {
+  assert(childAtIndex(1)->type() == Type::Symbol);
+  Symbol symbol = Symbol(static_cast<SymbolNode *>(childAtIndex(1)));
+  VariableContext variableContext = VariableContext(symbol.name(), approximationContext.context());
+  ApproximationContext childContext = approximationContext;
+  childContext.setContext(&variableContext);
+  for (int i = 0; i < n; i++) {
+    variableContext.setApproximationForVariable<T>(x[i]);
+    values[i] = childAtIndex(0)->approximate(T(), childContext).toScalar();
+  }
+}
+
 template<typename T>
 Evaluation<T> ParameteredExpressionNode::approximateFirstChildWithArgument(T x, const ApproximationContext& approximationContext) const {
   return approximateExpressionWithArgument(childAtIndex(0), x, approximationContext);
@@ -176,5 +189,7 @@ template Evaluation<float> ParameteredExpressionNode::approximateFirstChildWithA
 template Evaluation<double> ParameteredExpressionNode::approximateFirstChildWithArgument(double x, const ApproximationContext& approximationContext) const;
 template Evaluation<float> ParameteredExpressionNode::approximateExpressionWithArgument(ExpressionNode * expr, float x, const ApproximationContext& approximationContext) const;
 template Evaluation<double> ParameteredExpressionNode::approximateExpressionWithArgument(ExpressionNode * expr, double x, const ApproximationContext& approximationContext) const;
+template void ParameteredExpressionNode::firstChildScalarValuesForArguments(const float * x, float * values, int n, const ApproximationContext& approximationContext) const;
+template void ParameteredExpressionNode::firstChildScalarValuesForArguments(const double * x, double * values, int n, const ApproximationContext& approximationContext) const;
 
 }
@@ -30,40 +30,6 @@ PrintFloat::Long::Long(int64_t i) :
   m_digits[0] = (nonNegativeI - m_digits[1]) / k_base;
 }
 
-PrintFloat::Long::Long(uint32_t d1, uint32_t d2, bool negative) {
-  m_digits[1] = d2;
-  m_digits[0] = d1;
-  m_negative = negative && !isZero();
-}
-
-void PrintFloat::Long::DivisionByTen(const Long & longToDivide, Long * quotient, Long * digit) {
-  assert(quotient != nullptr && digit != nullptr);
-  if (longToDivide.isZero()) {
-    *quotient = Long(0);
-    *digit = Long(0);
-    return;
-  }
-
-  uint32_t digit0 = longToDivide.digit(0);
-  uint32_t digit1 = longToDivide.digit(1);
-
-  uint32_t d = digit1 % 10;
-  uint32_t digit1DividedByTen = (digit1 - d)/10;
-  *digit = Long(d);
-
-  if (digit0 == 0) {
-    *quotient = Long(0, digit1DividedByTen, longToDivide.isNegative());
-  } else {
-    *quotient = Long(digit0/10, digit1DividedByTen + (k_base/10) * (digit0 % 10), longToDivide.isNegative());
-  }
-}
-
-void PrintFloat::Long::MultiplySmallLongByTen(Long & smallLong) {
-  assert(smallLong.digit(0) == 0 && smallLong.digit(1) < (k_base/1000) && !smallLong.isZero());
-  uint32_t newDigit1 = smallLong.digit(1) * 10;
-  smallLong = Long(0, newDigit1, smallLong.isNegative());
-}
-
 int PrintFloat::Long::serialize(char * buffer, int bufferSize) const {
   if (bufferSize == 0) {
     return bufferSize-1;
@@ -216,7 +182,7 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
    * With doubles, 0.000600000028 * 10^10 = 6000000.2849...
    * This value is then rounded into mantissa = 6000000 which yields a proper
    * display of 0.0006 */
-  double unroundedMantissa = static_cast<double>(f) * std::pow(10.0, (double)(numberOfSignificantDigits - 1 - exponentInBase10));
+  double unroundedMantissa = static_cast<double>(f) * IEEE754<double>::powerOfTen(numberOfSignificantDigits - 1 - exponentInBase10);
   // Round mantissa to get the right number of significant digits
   double mantissa = std::round(unroundedMantissa);
 
@@ -277,7 +243,7 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
   assert(numberOfSignificantDigits < std::log10(std::pow(2.0f, 63.0f)));
 
   // Remove/Add the zeroes on the right side of the mantissa
-  Long dividend = Long((int64_t)mantissa);
+  int64_t mantissaDigits = static_cast<int64_t>(mantissa);
 
   int exponentForEngineeringNotation = 0;
   int minimalNumberOfMantissaDigits = 1;
@@ -292,17 +258,13 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
       assert(numberOfCharsForMantissaWithoutSign - numberOfSignificantDigits < 3);
       for (int i = 0; i < numberOfZeroesToAdd; i++) {
         assert(mantissa < 1000);
-        Long::MultiplySmallLongByTen(dividend);
+        mantissaDigits *= 10;
       }
     }
   }
   if (removeZeroes) {
-    Long digit;
-    Long quotient;
-    Long::DivisionByTen(dividend, &quotient, &digit);
     int minimumNumberOfCharsInMantissa = mode == Preferences::PrintFloatMode::Engineering ? minimalNumberOfMantissaDigits : 1;
-    int numberOfZerosRemoved = 0;
-    while (digit.isZero()
+    while (mantissaDigits % 10 == 0
         && numberOfCharsForMantissaWithoutSign > minimumNumberOfCharsInMantissa
         && (numberOfCharsForMantissaWithoutSign > exponentInBase10 + 1
           || mode == Preferences::PrintFloatMode::Scientific
@@ -310,9 +272,7 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
     {
       assert(UTF8Decoder::CharSizeOfCodePoint('0') == 1);
       numberOfCharsForMantissaWithoutSign--;
-      dividend = quotient;
-      Long::DivisionByTen(dividend, &quotient, &digit);
-      numberOfZerosRemoved++;
+      mantissaDigits /= 10;
     }
     if (numberOfCharsForMantissaWithoutSign > availableCharLength) {
       // Escape now if the true number of needed digits is not required
@@ -383,6 +343,7 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
     // Exception 3: We are about to overflow the buffer.
     return exceptionResult;
   }
+  Long dividend = Long(mantissaDigits);
   PrintLongWithDecimalMarker(buffer, numberOfCharsForMantissaWithSign, dividend, decimalMarkerPosition);
   if (doNotWriteExponent) {
     buffer[numberOfCharsForMantissaWithSign] = 0;
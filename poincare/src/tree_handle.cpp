@@ -79,6 +79,7 @@ void TreeHandle::replaceChildInPlace(TreeHandle oldChild, TreeHandle newChild) {
   TreePool::sharedPool()->move(TreePool::sharedPool()->last(), oldChild.node(), oldChild.numberOfChildren());
   oldChild.node()->release(oldChild.numberOfChildren());
   oldChild.deleteParentIdentifier();
+  node()->didChangeChildren();
 }
 
 void TreeHandle::replaceChildAtIndexInPlace(int oldChildIndex, TreeHandle newChild) {
@@ -115,6 +116,7 @@ void TreeHandle::mergeChildrenAtIndexInPlace(TreeHandle t, int i) {
   if (node()->hasChild(t.node())) {
     removeChildInPlace(t, 0);
   }
+  node()->didChangeChildren();
 }
 
 void TreeHandle::swapChildrenInPlace(int i, int j) {
@@ -129,6 +131,7 @@ void TreeHandle::swapChildrenInPlace(int i, int j) {
   TreeHandle secondChild = childAtIndex(secondChildIndex);
   TreePool::sharedPool()->move(firstChild.node()->nextSibling(), secondChild.node(), secondChild.numberOfChildren());
   TreePool::sharedPool()->move(childAtIndex(secondChildIndex).node()->nextSibling(), firstChild.node(), firstChild.numberOfChildren());
+  node()->didChangeChildren();
 }
 
 #if POINCARE_TREE_LOG
@@ -163,6 +166,7 @@ void TreeHandle::addChildAtIndexInPlace(TreeHandle t, int index, int currentNumb
   t.setParentIdentifier(identifier());
 
   node()->didChangeArity(currentNumberOfChildren+1);
+  node()->didChangeChildren();
 }
 
 // Remove
@@ -183,12 +187,14 @@ void TreeHandle::removeChildInPlace(TreeHandle t, int childNumberOfChildren) {
   t.node()->release(childNumberOfChildren);
   t.deleteParentIdentifier();
   node()->incrementNumberOfChildren(-1);
+  node()->didChangeChildren();
 }
 
 void TreeHandle::removeChildrenInPlace(int currentNumberOfChildren) {
   assert(!isUninitialized());
   deleteParentIdentifierInChildren();
   TreePool::sharedPool()->removeChildren(node(), currentNumberOfChildren);
+  node()->didChangeChildren();
 }
 
 /* Private */
@@ -259,7 +265,7 @@ TreeHandle TreeHandle::BuildWithGhostChildren(TreeNode * node) {
   int expectedNumberOfChildren = node->numberOfChildren();
   /* Ensure the pool is syntaxically correct by creating ghost children for
    * nodes that have a fixed, non-zero number of children. */
-  uint16_t nodeIdentifier = pool->generateIdentifier();
+  TreeNode::Identifier nodeIdentifier = pool->generateIdentifier();
   node->rename(nodeIdentifier, false, true);
   for (int i = 0; i < expectedNumberOfChildren; i++) {
     GhostNode * ghost = new (pool->alloc(sizeof(GhostNode))) GhostNode();
@@ -267,11 +273,17 @@ TreeHandle TreeHandle::BuildWithGhostChildren(TreeNode * node) {
     ghost->setParentIdentifier(nodeIdentifier);
     ghost->retain();
     assert((char *)ghost == (char *)node->next() + i*Helpers::AlignedSize(sizeof(GhostNode), ByteAlignment));
+#if POINCARE_TREE_STATS
+    pool->recordAllocation(ghost);
+#endif
   }
+#if POINCARE_TREE_STATS
+  pool->recordAllocation(node);
+#endif
   return TreeHandle(node);
 }
 
-void TreeHandle::setIdentifierAndRetain(uint16_t newId) {
+void TreeHandle::setIdentifierAndRetain(TreeNode::Identifier newId) {
   m_identifier = newId;
   if (!isUninitialized()) {
     node()->retain();
@@ -289,7 +301,7 @@ void TreeHandle::setTo(const TreeHandle & tr) {
   release(currentId);
 }
 
-void TreeHandle::release(uint16_t identifier) {
+void TreeHandle::release(TreeNode::Identifier identifier) {
   if (!hasNode(identifier)) {
     return;
   }
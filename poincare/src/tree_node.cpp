@@ -14,7 +14,7 @@ void TreeNode::release(int currentNumberOfChildren) {
   }
 }
 
-void TreeNode::rename(uint16_t identifier, bool unregisterPreviousIdentifier, bool skipChildrenUpdate) {
+void TreeNode::rename(Identifier identifier, bool unregisterPreviousIdentifier, bool skipChildrenUpdate) {
   if (unregisterPreviousIdentifier) {
     /* The previous identifier should not always be unregistered. For instance,
      * if the node is a clone and still has the original node's identifier,
@@ -205,7 +205,7 @@ size_t TreeNode::deepSize(int realNumberOfChildren) const {
     reinterpret_cast<const char *>(this);
 }
 
-void TreeNode::changeParentIdentifierInChildren(uint16_t id) const {
+void TreeNode::changeParentIdentifierInChildren(Identifier id) const {
   for (TreeNode * c : directChildren()) {
     c->setParentIdentifier(id);
   }
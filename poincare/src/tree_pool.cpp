@@ -5,6 +5,7 @@
 #include <poincare/tree_handle.h>
 #include <string.h>
 #include <stdint.h>
+#include <algorithm>
 
 namespace Poincare {
 
@@ -14,9 +15,9 @@ bool TreePool::s_treePoolLocked = false;
 
 TreePool * TreePool::SharedStaticPool = nullptr;
 
-void TreePool::freeIdentifier(uint16_t identifier) {
+void TreePool::freeIdentifier(TreeNode::Identifier identifier) {
   if (TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes) {
-    m_nodeForIdentifierOffset[identifier] = UINT16_MAX;
+    m_nodeForIdentifierOffset[identifier] = k_noNodeOffset;
     m_identifiers.push(identifier);
   }
 }
@@ -58,6 +59,12 @@ TreeNode * TreePool::copyTreeFromAddress(const void * address, size_t size) {
     renameNode(child, false);
     child->retain();
   }
+#if POINCARE_TREE_STATS
+  recordAllocation(copy);
+  for (TreeNode * child : copy->depthFirstChildren()) {
+    recordAllocation(child);
+  }
+#endif
   return copy;
 }
 
@@ -82,6 +89,10 @@ void TreePool::moveNodes(TreeNode * destination, TreeNode * source, size_t moveS
   size_t len = moveSize/4;
 
   if (Helpers::Rotate(dst, src, len)) {
+#if POINCARE_TREE_STATS
+    // Rotate moves the whole span between the source and the destination
+    m_statistics.numberOfMovedBytes += dst < src ? (src - dst + len) * sizeof(uint32_t) : (dst - src) * sizeof(uint32_t);
+#endif
     updateNodeForIdentifierFromNode(dst < src ? destination : source);
   }
 }
@@ -91,6 +102,9 @@ void TreePool::flatLog(std::ostream & stream) {
   size_t size = static_cast<char *>(m_cursor) - static_cast<char *>(buffer());
   stream << "<TreePool format=\"flat\" size=\"" << size << "\">";
   for (TreeNode * node : allNodes()) {
+    if (TombstoneNode::IsTombstone(node)) {
+      continue;
+    }
     node->log(stream, false);
   }
   stream << "</TreePool>";
@@ -100,6 +114,9 @@ void TreePool::flatLog(std::ostream & stream) {
 void TreePool::treeLog(std::ostream & stream, bool verbose) {
   stream << "<TreePool format=\"tree\" size=\"" << (int)(m_cursor-buffer()) << "\">";
   for (TreeNode * node : roots()) {
+    if (TombstoneNode::IsTombstone(node)) {
+      continue;
+    }
     node->log(stream, true, 1, verbose);
   }
   stream << std::endl;
@@ -109,12 +126,47 @@ void TreePool::treeLog(std::ostream & stream, bool verbose) {
 
 #endif
 
+#if POINCARE_TREE_STATS
+void TreePool::resetStatistics() {
+  memset(&m_statistics, 0, sizeof(Statistics));
+  m_statistics.peakNumberOfBytes = m_cursor - constBuffer();
+}
+
+static void logHistogram(std::ostream & stream, const char * family, int firstBucket, int lastBucket, const TreePool::Statistics * statistics) {
+  for (int i = firstBucket; i < lastBucket; i++) {
+    if (statistics->allocationsPerBucket[i] == 0 && statistics->deallocationsPerBucket[i] == 0) {
+      continue;
+    }
+    stream << "  <" << family << " type=\"" << i - firstBucket << "\" allocations=\"" << statistics->allocationsPerBucket[i] << "\" deallocations=\"" << statistics->deallocationsPerBucket[i] << "\"/>" << std::endl;
+  }
+}
+
+void TreePool::statisticsLog(std::ostream & stream, bool withHistograms) const {
+  stream << "<TreePoolStatistics allocations=\"" << m_statistics.numberOfAllocations
+         << "\" deallocations=\"" << m_statistics.numberOfDeallocations
+         << "\" movedBytes=\"" << m_statistics.numberOfMovedBytes
+         << "\" peakBytes=\"" << m_statistics.peakNumberOfBytes
+         << "\" bufferSize=\"" << BufferSize
+         << "\" overflows=\"" << m_statistics.numberOfOverflows << "\"";
+  if (!withHistograms) {
+    stream << "/>" << std::endl;
+    return;
+  }
+  stream << ">" << std::endl;
+  // Types are the values of ExpressionNode::Type and LayoutNode::Type
+  logHistogram(stream, "Expression", 0, TreeNode::k_layoutStatisticsBucketOffset, &m_statistics);
+  logHistogram(stream, "Layout", TreeNode::k_layoutStatisticsBucketOffset, TreeNode::k_otherStatisticsBucket, &m_statistics);
+  logHistogram(stream, "Other", TreeNode::k_otherStatisticsBucket, TreeNode::k_numberOfStatisticsBuckets, &m_statistics);
+  stream << "</TreePoolStatistics>" << std::endl;
+}
+#endif
+
 int TreePool::numberOfNodes() const {
   int count = 0;
   TreeNode * firstNode = first();
   TreeNode * lastNode = last();
   while (firstNode != lastNode) {
-    count++;
+    count += !TombstoneNode::IsTombstone(firstNode);
     firstNode = firstNode->next();
   }
   return count;
@@ -128,10 +180,27 @@ void * TreePool::alloc(size_t size) {
 
   size = Helpers::AlignedSize(size, ByteAlignment);
   if (m_cursor + size > buffer() + BufferSize) {
+    /* Callers may hold pointers to any living node across an allocation, for
+     * instance to the digits an Integer is built from, so no node can be
+     * moved here. Only the tombstones ending the pool are dropped, which the
+     * end of a checkpoint may have prevented until now. */
+    dropTombstonesEndingPool();
+  }
+  if (m_cursor + size > buffer() + BufferSize) {
+#if POINCARE_TREE_STATS
+    m_statistics.numberOfOverflows++;
+#endif
     ExceptionCheckpoint::Raise();
   }
   void * result = m_cursor;
   m_cursor += size;
+#if POINCARE_TREE_STATS
+  m_statistics.numberOfAllocations++;
+  uint32_t usedBytes = m_cursor - buffer();
+  if (usedBytes > m_statistics.peakNumberOfBytes) {
+    m_statistics.peakNumberOfBytes = usedBytes;
+  }
+#endif
   return result;
 }
 
@@ -145,36 +214,205 @@ void TreePool::dealloc(TreeNode * node, size_t size) {
   char * ptr = reinterpret_cast<char *>(node);
   assert(ptr >= buffer() && ptr < m_cursor);
 
-  // Step 1 - Compact the pool
-  memmove(
-    ptr,
-    ptr + size,
-    m_cursor - (ptr + size)
-  );
-  m_cursor -= size;
+  if (ptr + size == m_cursor) {
+    // The node is the last one, there is nothing to compact
+    m_cursor = ptr;
+    dropTombstonesEndingPool();
+  } else {
+    /* Instead of moving all the following nodes back, leave a tombstone that
+     * will be swept with the others. Simplifications free many small nodes,
+     * which used to cost a whole move of the end of the pool each. */
+    m_numberOfDeadBytes += size;
+    /* Merge it with the adjacent tombstones, so that the ones ending the pool
+     * can be dropped at once when the last node is freed. */
+    TreeNode * following = reinterpret_cast<TreeNode *>(ptr + size);
+    if (m_lastTombstone != nullptr
+     && IsAfterTopmostCheckpoint(m_lastTombstone)
+     && reinterpret_cast<char *>(m_lastTombstone->next()) == ptr
+     && m_lastTombstone->size() + size <= TombstoneNode::k_maxSize) {
+      size += m_lastTombstone->size();
+      node = m_lastTombstone;
+    }
+    // A tombstone spanning the end of a checkpoint would break its rollback
+    if (IsAfterTopmostCheckpoint(node)
+     && TombstoneNode::IsTombstone(following)
+     && size + following->size() <= TombstoneNode::k_maxSize) {
+      size += following->size();
+      if (m_lastTombstone == following) {
+        m_lastTombstone = node;
+      }
+    }
+    if (m_lastTombstone == nullptr || node > m_lastTombstone) {
+      m_lastTombstone = node;
+    }
+    new (node) TombstoneNode(size);
+    if (m_firstTombstone == nullptr || node < m_firstTombstone) {
+      m_firstTombstone = node;
+    }
+    /* Callers expect the nodes following a freed node to move, but not the
+     * ones preceding it: only sweep from the tombstones this node ends. The
+     * tombstones left below the start of the last sweep do not count, as
+     * sweeping from a node above them would not reclaim them. Once a node
+     * below them dies, they may be reclaimed and are counted again. */
+    TreeNode * runStart = nullptr;
+    if (node < m_lastSweepStart && m_numberOfDeadBytesLeftBySweep > k_maxNumberOfDeadBytes) {
+      runStart = firstTombstoneOfRun(node, &m_numberOfDeadBytesLeftBySweep);
+      m_lastSweepStart = runStart;
+    }
+    if (m_numberOfDeadBytes - m_numberOfDeadBytesLeftBySweep > k_maxNumberOfDeadBytes) {
+      compactFromNode(runStart != nullptr ? runStart : firstTombstoneOfRun(node));
+    }
+  }
 
-  // Step 2: Update m_nodeForIdentifierOffset for all nodes downstream
+  // If only tombstones are left from the first one, drop them all
+  if (m_firstTombstone != nullptr
+   && IsAfterTopmostCheckpoint(m_firstTombstone)
+   && static_cast<size_t>(m_cursor - reinterpret_cast<char *>(m_firstTombstone)) == m_numberOfDeadBytes) {
+    m_cursor = reinterpret_cast<char *>(m_firstTombstone);
+    m_firstTombstone = nullptr;
+    m_lastTombstone = nullptr;
+    m_numberOfDeadBytes = 0;
+    m_numberOfDeadBytesLeftBySweep = 0;
+    m_lastSweepStart = nullptr;
+  }
+}
+
+void TreePool::dropTombstonesEndingPool() {
+  while (m_lastTombstone != nullptr
+      && IsAfterTopmostCheckpoint(m_lastTombstone)
+      && reinterpret_cast<char *>(m_lastTombstone->next()) == m_cursor) {
+    size_t size = m_lastTombstone->size();
+    assert(m_numberOfDeadBytes >= size);
+    m_cursor = reinterpret_cast<char *>(m_lastTombstone);
+    m_numberOfDeadBytes -= size;
+    m_numberOfDeadBytesLeftBySweep = std::min(m_numberOfDeadBytesLeftBySweep, m_numberOfDeadBytes);
+    m_lastTombstone = lastTombstoneBelow(m_lastTombstone);
+    if (m_lastTombstone == nullptr) {
+      assert(m_numberOfDeadBytes == 0);
+      m_firstTombstone = nullptr;
+    }
+  }
+}
+
+TreeNode * TreePool::firstTombstoneOfRun(TreeNode * tombstone, size_t * numberOfDeadBytesBelow) const {
+  /* Tombstones can only be merged into the highest one, so a run of adjacent
+   * tombstones may not have been merged. */
+  TreeNode * topmostEndOfPool = Checkpoint::TopmostEndOfPool();
+  TreeNode * runStart = nullptr;
+  size_t deadBytesBelowRun = 0;
+  size_t deadBytes = 0;
+  for (TreeNode * n = m_firstTombstone; n < tombstone; n = n->next()) {
+    bool isTombstone = TombstoneNode::IsTombstone(n);
+    // The nodes below the topmost checkpoint cannot be moved
+    if (!isTombstone || n < topmostEndOfPool) {
+      runStart = nullptr;
+    } else if (runStart == nullptr) {
+      runStart = n;
+      deadBytesBelowRun = deadBytes;
+    }
+    if (isTombstone) {
+      deadBytes += Helpers::AlignedSize(n->size(), ByteAlignment);
+    }
+  }
+  if (runStart == nullptr) {
+    runStart = tombstone;
+    deadBytesBelowRun = deadBytes;
+  }
+  if (numberOfDeadBytesBelow != nullptr) {
+    *numberOfDeadBytesBelow = deadBytesBelowRun;
+  }
+  return runStart;
+}
+
+TreeNode * TreePool::lastTombstoneBelow(TreeNode * node) const {
+  TreeNode * result = nullptr;
+  for (TreeNode * n = m_firstTombstone; n != nullptr && n < node; n = n->next()) {
+    if (TombstoneNode::IsTombstone(n)) {
+      result = n;
+    }
+  }
+  return result;
+}
+
+void TreePool::compactFromNode(TreeNode * node) {
+  assert(IsAfterTopmostCheckpoint(node));
+  char * destination = reinterpret_cast<char *>(node);
+  char * source = destination;
+  while (source < m_cursor) {
+    // Skip tombstones
+    TreeNode * n = reinterpret_cast<TreeNode *>(source);
+    if (TombstoneNode::IsTombstone(n)) {
+      size_t size = Helpers::AlignedSize(n->size(), ByteAlignment);
+      assert(m_numberOfDeadBytes >= size);
+      m_numberOfDeadBytes -= size;
+      source += size;
+      continue;
+    }
+    // Move the following run of living nodes at once
+    char * runStart = source;
+    while (source < m_cursor && !TombstoneNode::IsTombstone(reinterpret_cast<TreeNode *>(source))) {
+      source = reinterpret_cast<char *>(reinterpret_cast<TreeNode *>(source)->next());
+    }
+    if (destination != runStart) {
+      memmove(destination, runStart, source - runStart);
+#if POINCARE_TREE_STATS
+      m_statistics.numberOfMovedBytes += source - runStart;
+#endif
+    }
+    destination += source - runStart;
+  }
+  m_cursor = destination;
+  // The tombstones left are all below the node
+  m_numberOfDeadBytesLeftBySweep = m_numberOfDeadBytes;
+  m_lastSweepStart = node;
+  if (node <= m_firstTombstone) {
+    assert(m_numberOfDeadBytes == 0);
+    m_firstTombstone = nullptr;
+  }
   updateNodeForIdentifierFromNode(node);
+  m_lastTombstone = lastTombstoneBelow(node);
 }
 
 void TreePool::discardTreeNode(TreeNode * node) {
-  uint16_t nodeIdentifier = node->identifier();
+  TreeNode::Identifier nodeIdentifier = node->identifier();
   size_t size = node->size();
+#if POINCARE_TREE_STATS
+  m_statistics.numberOfDeallocations++;
+  m_statistics.deallocationsPerBucket[node->statisticsBucket()]++;
+#endif
   node->~TreeNode();
   dealloc(node, size);
   freeIdentifier(nodeIdentifier);
 }
 
 void TreePool::registerNode(TreeNode * node) {
-  uint16_t nodeID = node->identifier();
+  TreeNode::Identifier nodeID = node->identifier();
   assert(nodeID < MaxNumberOfNodes);
   const int nodeOffset = (((char *)node) - (char *)m_alignedBuffer)/ByteAlignment;
-  assert(nodeOffset < k_maxNodeOffset); // Check that the offset can be stored in a uint16_t
+  assert(nodeOffset < k_maxNodeOffset); // Check that the offset can be stored in a NodeOffset
   m_nodeForIdentifierOffset[nodeID] = nodeOffset;
 }
 
 void TreePool::updateNodeForIdentifierFromNode(TreeNode * node) {
+  // Tombstones may have been moved along with the nodes
+  bool updateFirstTombstone = m_firstTombstone != nullptr && m_firstTombstone >= node;
+  if (updateFirstTombstone) {
+    m_firstTombstone = nullptr;
+  }
+  bool updateLastTombstone = m_lastTombstone != nullptr && m_lastTombstone >= node;
+  if (updateLastTombstone) {
+    m_lastTombstone = nullptr;
+  }
   for (TreeNode * n : Nodes(node)) {
+    if (TombstoneNode::IsTombstone(n)) {
+      if (updateFirstTombstone && m_firstTombstone == nullptr) {
+        m_firstTombstone = n;
+      }
+      if (updateLastTombstone) {
+        m_lastTombstone = n;
+      }
+      continue;
+    }
     registerNode(n);
   }
 }
@@ -185,18 +423,18 @@ bool TreePool::IsAfterTopmostCheckpoint(TreeNode * node) {
 
 // Reset IdentifierStack, make all identifiers available
 void TreePool::IdentifierStack::reset() {
-  for (uint16_t i = 0; i < MaxNumberOfNodes; i++) {
+  for (TreeNode::Identifier i = 0; i < MaxNumberOfNodes; i++) {
     m_availableIdentifiers[i] = i;
   }
   m_currentIndex = MaxNumberOfNodes;
 }
 
-void TreePool::IdentifierStack::push(uint16_t i) {
+void TreePool::IdentifierStack::push(TreeNode::Identifier i) {
   assert(TreeNode::IsValidIdentifier(m_currentIndex) && m_currentIndex < MaxNumberOfNodes);
   m_availableIdentifiers[m_currentIndex++] = i;
 }
 
-uint16_t TreePool::IdentifierStack::pop() {
+TreeNode::Identifier TreePool::IdentifierStack::pop() {
   if (m_currentIndex == 0) {
     assert(false);
     return 0;
@@ -206,14 +444,14 @@ uint16_t TreePool::IdentifierStack::pop() {
 }
 
 // Remove an available identifier.
-void TreePool::IdentifierStack::remove(uint16_t j) {
+void TreePool::IdentifierStack::remove(TreeNode::Identifier j) {
   assert(TreeNode::IsValidIdentifier(j));
   /* TODO : Implement an optimized binary search using the sorted state.
    * Alternatively, it may be worth using another data type such as a sorted
    * list instead of a stack. */
-  for (uint16_t i = 0; i < m_currentIndex; i++) {
+  for (TreeNode::Identifier i = 0; i < m_currentIndex; i++) {
     if (m_availableIdentifiers[i] == j) {
-      memmove(m_availableIdentifiers + i, m_availableIdentifiers + i + 1, (m_currentIndex - i - 1) * sizeof(uint16_t));
+      memmove(m_availableIdentifiers + i, m_availableIdentifiers + i + 1, (m_currentIndex - i - 1) * sizeof(TreeNode::Identifier));
       m_currentIndex -= 1;
       return;
     }
@@ -222,9 +460,9 @@ void TreePool::IdentifierStack::remove(uint16_t j) {
 }
 
 // Reset m_nodeForIdentifierOffset for all available identifiers
-void TreePool::IdentifierStack::resetNodeForIdentifierOffsets(uint16_t * nodeForIdentifierOffset) const {
-  for (uint16_t i = 0; i < m_currentIndex; i++) {
-    nodeForIdentifierOffset[m_availableIdentifiers[i]] = UINT16_MAX;
+void TreePool::IdentifierStack::resetNodeForIdentifierOffsets(NodeOffset * nodeForIdentifierOffset) const {
+  for (TreeNode::Identifier i = 0; i < m_currentIndex; i++) {
+    nodeForIdentifierOffset[m_availableIdentifiers[i]] = k_noNodeOffset;
   }
 }
 
@@ -236,11 +474,25 @@ void TreePool::freePoolFromNode(TreeNode * firstNodeToDiscard) {
 
   // Free all identifiers
   m_identifiers.reset();
+  m_firstTombstone = nullptr;
+  m_lastTombstone = nullptr;
+  m_numberOfDeadBytes = 0;
   TreeNode * currentNode = first();
   while (currentNode < firstNodeToDiscard) {
-    m_identifiers.remove(currentNode->identifier());
+    if (TombstoneNode::IsTombstone(currentNode)) {
+      if (m_firstTombstone == nullptr) {
+        m_firstTombstone = currentNode;
+      }
+      m_lastTombstone = currentNode;
+      m_numberOfDeadBytes += Helpers::AlignedSize(currentNode->size(), ByteAlignment);
+    } else {
+      m_identifiers.remove(currentNode->identifier());
+    }
     currentNode = currentNode->next();
   }
+  // The tombstones below the discarded nodes are below a checkpoint
+  m_numberOfDeadBytesLeftBySweep = m_numberOfDeadBytes;
+  m_lastSweepStart = firstNodeToDiscard;
   assert(currentNode == firstNodeToDiscard);
   m_identifiers.resetNodeForIdentifierOffsets(m_nodeForIdentifierOffset);
   m_cursor = reinterpret_cast<char *>(currentNode);
@@ -0,0 +1,42 @@
+#include <apps/shared/global_context.h>
+#include <poincare/dataset_column.h>
+#include <poincare/integer.h>
+#include <poincare/statistics_dataset.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+QUIZ_BENCH(poincare_parse_and_simplify) {
+  Shared::GlobalContext globalContext;
+  Expression e = Expression::ParseAndSimplify("(3x^2+2x-1)/(x+1)+cos(π/6)×√(12)", &globalContext, Cartesian, Radian, MetricUnitFormat);
+  quiz_assert(!e.isUninitialized());
+}
+
+QUIZ_BENCH(poincare_approximate) {
+  Shared::GlobalContext globalContext;
+  Expression e = Expression::Parse("sum(1/k^2,k,1,100)+int(e^(-x^2),x,0,1)", &globalContext, false);
+  double result = e.approximateToScalar<double>(&globalContext, Cartesian, Radian);
+  quiz_assert(result > 1.0);
+}
+
+QUIZ_BENCH(poincare_integer_multiplication) {
+  Integer a("123456789012345678901234567890123456789012345678901234567890");
+  Integer b("987654321098765432109876543210987654321098765432109876543210");
+  Integer c = Integer::Multiplication(a, b);
+  quiz_assert(!c.isOverflow());
+}
+
+class BenchDatasetColumn : public DatasetColumn<double> {
+public:
+  double valueAtIndex(int index) const override { return static_cast<double>((index * 7919) % 1000); }
+  int length() const override { return 500; }
+};
+
+QUIZ_BENCH(poincare_statistics_dataset_quantiles) {
+  BenchDatasetColumn values;
+  StatisticsDataset<double> dataset(&values);
+  double firstQuartile = dataset.sortedElementAtCumulatedFrequency(0.25, false);
+  double median = dataset.median();
+  double thirdQuartile = dataset.sortedElementAtCumulatedFrequency(0.75, false);
+  quiz_assert(firstQuartile <= median && median <= thirdQuartile);
+}
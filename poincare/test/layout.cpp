@@ -154,3 +154,38 @@ QUIZ_CASE(poincare_layout_power) {
   c3.addEmptySquarePowerLayout(nullptr);
   assert_layout_serialize_to(l3, "((1^\u00122\u0013)^\u00122\u0013)");
 }
+
+void assert_memoized_measures_are_up_to_date(Layout memoized, Layout fresh) {
+  quiz_assert(memoized.numberOfChildren() == fresh.numberOfChildren());
+  for (KDFont::Size font : {KDFont::Size::Small, KDFont::Size::Large}) {
+    quiz_assert(memoized.layoutSize(font) == fresh.layoutSize(font));
+    quiz_assert(memoized.baseline(font) == fresh.baseline(font));
+    quiz_assert(memoized.absoluteOrigin(font) == fresh.absoluteOrigin(font));
+  }
+  for (int i = 0; i < memoized.numberOfChildren(); i++) {
+    assert_memoized_measures_are_up_to_date(memoized.childAtIndex(i), fresh.childAtIndex(i));
+  }
+}
+
+QUIZ_CASE(poincare_layout_memoized_measures) {
+  /* Measure a layout in both fonts between edits, and check that only
+   * dropping the memoized measures of the edited path gives the same results
+   * as measuring a fresh clone. */
+  Layout l = LayoutHelper::StringToCodePointsLayout("12+34", 5);
+  LayoutCursor c(l.childAtIndex(1), LayoutCursor::Position::Right);
+  assert_memoized_measures_are_up_to_date(l, l.clone());
+  c.addFractionLayoutAndCollapseSiblings(nullptr);
+  assert_memoized_measures_are_up_to_date(l, l.clone());
+  c.insertText("56", nullptr);
+  assert_memoized_measures_are_up_to_date(l, l.clone());
+  c.addEmptySquarePowerLayout(nullptr);
+  assert_memoized_measures_are_up_to_date(l, l.clone());
+  c.addEmptyMatrixLayout(nullptr);
+  assert_memoized_measures_are_up_to_date(l, l.clone());
+  c.insertText("7", nullptr);
+  assert_memoized_measures_are_up_to_date(l, l.clone());
+  c.performBackspace();
+  assert_memoized_measures_are_up_to_date(l, l.clone());
+  c.performBackspace();
+  assert_memoized_measures_are_up_to_date(l, l.clone());
+}
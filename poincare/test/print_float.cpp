@@ -1,3 +1,4 @@
+#include <poincare/ieee754.h>
 #include <string.h>
 #include <stdlib.h>
 #include <cmath>
@@ -219,3 +220,15 @@ QUIZ_CASE(assert_print_floats) {
   assert_float_prints_to(-0.001, "-1ᴇ-3", EngineeringMode, 7);
 
 }
+
+template<typename T>
+void assert_power_of_ten_is_exact() {
+  for (int i = -30; i <= 30; i++) {
+    quiz_assert(IEEE754<T>::powerOfTen(i) == std::pow(static_cast<T>(10.0), i));
+  }
+}
+
+QUIZ_CASE(poincare_power_of_ten) {
+  assert_power_of_ten_is_exact<float>();
+  assert_power_of_ten_is_exact<double>();
+}
@@ -2,6 +2,9 @@
 #include <poincare/tree_handle.h>
 #include <poincare/init.h>
 #include <poincare/exception_checkpoint.h>
+#include <poincare/addition.h>
+#include <poincare/integer.h>
+#include <poincare/rational.h>
 #include "blob_node.h"
 #include "pair_node.h"
 
@@ -87,6 +90,118 @@ QUIZ_CASE(tree_handle_memory_failure) {
 #endif
 }
 
+QUIZ_CASE(tree_handle_memory_failure_after_filling_pool) {
+#if !__EMSCRIPTEN__
+  // The identifier tables must not run out before the buffer does
+  volatile int numberOfPairs = 0;
+  Poincare::ExceptionCheckpoint ecp;
+  if (ExceptionRun(ecp)) {
+    TreeHandle tree = BlobByReference::Builder(1);
+    while (true) {
+      tree = PairByReference::Builder(tree, BlobByReference::Builder(1));
+      numberOfPairs = numberOfPairs + 1;
+    }
+  }
+  constexpr int pairSize = sizeof(PairNode) + sizeof(BlobNode);
+  // Leave room for the nodes being built and the tombstones they leave
+  constexpr int slack = 3 * pairSize;
+  quiz_assert(numberOfPairs * pairSize >= TreePoolBufferSize - slack);
+#endif
+}
+
+static int number_of_pairs_filling_pool(bool leaveTrailingTombstones) {
+  constexpr int k_numberOfHandles = TreePoolBufferSize / 64 / sizeof(BlobNode);
+  volatile int numberOfPairs = 0;
+  Poincare::ExceptionCheckpoint ecp;
+  if (ExceptionRun(ecp)) {
+    // A tombstone below a node outliving it is never dropped
+    Expression pinned = Rational::Builder(0);
+    Expression survivor = Rational::Builder(k_numberOfHandles);
+    pinned = Expression();
+    if (leaveTrailingTombstones) {
+      Expression handles[k_numberOfHandles];
+      for (int i = 0; i < k_numberOfHandles; i++) {
+        handles[i] = Rational::Builder(i);
+      }
+      for (int i = 0; i < k_numberOfHandles; i++) {
+        handles[i] = Expression();
+      }
+    }
+    TreeHandle tree = BlobByReference::Builder(1);
+    while (true) {
+      tree = PairByReference::Builder(tree, BlobByReference::Builder(1));
+      numberOfPairs = numberOfPairs + 1;
+      quiz_assert(survivor.isIdenticalTo(Rational::Builder(k_numberOfHandles)));
+    }
+  }
+  return numberOfPairs;
+}
+
+QUIZ_CASE(tree_handle_tombstones_ending_the_pool_are_dropped) {
+#if !__EMSCRIPTEN__
+  int initialPoolSize = pool_size();
+  int numberOfPairs = number_of_pairs_filling_pool(false);
+  // The new nodes use the space of the tombstones ending the pool
+  quiz_assert(number_of_pairs_filling_pool(true) >= numberOfPairs);
+  assert_pool_size(initialPoolSize);
+#endif
+}
+
+QUIZ_CASE(tree_handle_builders_copy_pool_data_at_overflow) {
+#if !__EMSCRIPTEN__
+  int initialPoolSize = pool_size();
+  {
+    Poincare::ExceptionCheckpoint ecp;
+    if (ExceptionRun(ecp)) {
+      Rational expected = Rational::Builder("12345678901234567890", "98765432109876543211");
+      TreeHandle tree = BlobByReference::Builder(1);
+      while (true) {
+        /* Dividing the integers by their GCD leaves tombstones below the
+         * digits the rational is built from. */
+        Integer numerator("12345678901234567890");
+        Integer denominator("98765432109876543211");
+        Rational rational = Rational::Builder(numerator, denominator);
+        quiz_assert(rational.isIdenticalTo(expected));
+        tree = PairByReference::Builder(tree, BlobByReference::Builder(1));
+      }
+    }
+  }
+  assert_pool_size(initialPoolSize);
+#endif
+}
+
+QUIZ_CASE(tree_handle_tombstones_left_by_sweeps_are_not_swept_again) {
+  int initialPoolSize = pool_size();
+  char * initialCursor = TreePool::sharedPool()->cursor();
+  constexpr int k_numberOfHandles = TreePoolBufferSize / 4 / sizeof(BlobNode);
+  {
+    Expression handles[k_numberOfHandles];
+    for (int i = 0; i < k_numberOfHandles; i++) {
+      handles[i] = Rational::Builder(i);
+    }
+    /* Free every other node from the first one, until enough bytes die to
+     * sweep. A sweep from a freed node cannot reclaim the tombstones below
+     * it. */
+    int i = 0;
+    char * cursor = TreePool::sharedPool()->cursor();
+    while (TreePool::sharedPool()->cursor() == cursor) {
+      quiz_assert(i < k_numberOfHandles);
+      handles[i] = Expression();
+      i += 2;
+    }
+    // The tombstones left by the sweep do not trigger a sweep on each free
+    cursor = TreePool::sharedPool()->cursor();
+    quiz_assert(i < k_numberOfHandles);
+    handles[i] = Expression();
+    quiz_assert(TreePool::sharedPool()->cursor() == cursor);
+    for (int j = 1; j < k_numberOfHandles; j += 2) {
+      quiz_assert(handles[j].isIdenticalTo(Rational::Builder(j)));
+    }
+  }
+  assert_pool_size(initialPoolSize);
+  quiz_assert(TreePool::sharedPool()->cursor() == initialCursor);
+}
+
 QUIZ_CASE(tree_handle_does_not_copy) {
   int initialPoolSize = pool_size();
   BlobByReference b1 = BlobByReference::Builder(1);
@@ -97,3 +212,64 @@ QUIZ_CASE(tree_handle_does_not_copy) {
   PairByReference p2 = p;
   assert_pool_size(initialPoolSize+3);
 }
+
+QUIZ_CASE(tree_handle_freed_nodes_are_compacted) {
+  int initialPoolSize = pool_size();
+  char * initialCursor = TreePool::sharedPool()->cursor();
+  constexpr int k_numberOfHandles = 400;
+  {
+    Expression handles[k_numberOfHandles];
+    for (int i = 0; i < k_numberOfHandles; i++) {
+      handles[i] = Rational::Builder(i);
+    }
+    /* Free every other node, leaving holes in the middle of the pool. Enough
+     * bytes die to trigger some compactions. */
+    for (int i = 0; i < k_numberOfHandles; i += 2) {
+      handles[i] = Expression();
+    }
+    assert_pool_size(initialPoolSize + k_numberOfHandles/2);
+    for (int i = 1; i < k_numberOfHandles; i += 2) {
+      quiz_assert(handles[i].isIdenticalTo(Rational::Builder(i)));
+    }
+    // Nodes allocated afterwards can be modified
+    handles[0] = Addition::Builder(handles[1], handles[3]);
+    quiz_assert(handles[0].isIdenticalTo(Addition::Builder(Rational::Builder(1), Rational::Builder(3))));
+    handles[0] = Expression();
+    // Free the nodes from the first one, each of them is in the middle
+    for (int i = 1; i < k_numberOfHandles - 1; i += 2) {
+      handles[i] = Expression();
+      if (i + 2 < k_numberOfHandles) {
+        quiz_assert(handles[i + 2].isIdenticalTo(Rational::Builder(i + 2)));
+      }
+    }
+  }
+  assert_pool_size(initialPoolSize);
+  // No tombstone is left behind
+  quiz_assert(TreePool::sharedPool()->cursor() == initialCursor);
+}
+
+QUIZ_CASE(tree_handle_pool_statistics) {
+  /* Test cases are listed from the sources whatever the flags, so the case
+   * is kept empty in builds without statistics. */
+#if POINCARE_TREE_STATS
+  TreePool * pool = TreePool::sharedPool();
+  pool->resetStatistics();
+  {
+    BlobByReference b = BlobByReference::Builder(1);
+    PairByReference p = PairByReference::Builder(b, BlobByReference::Builder(2));
+  }
+  const TreePool::Statistics * statistics = pool->statistics();
+  // Two blobs, a pair and its two ghost children
+  quiz_assert(statistics->numberOfAllocations == 5);
+  quiz_assert(statistics->numberOfDeallocations == 5);
+  quiz_assert(statistics->allocationsPerBucket[TreeNode::k_otherStatisticsBucket] == 5);
+  quiz_assert(statistics->peakNumberOfBytes >= 3 * sizeof(BlobNode));
+  quiz_assert(statistics->numberOfMovedBytes > 0);
+  quiz_assert(statistics->numberOfOverflows == 0);
+
+  pool->resetStatistics();
+  Expression e = Addition::Builder(Rational::Builder(1), Rational::Builder(2));
+  quiz_assert(statistics->allocationsPerBucket[static_cast<int>(ExpressionNode::Type::Addition)] == 1);
+  quiz_assert(statistics->allocationsPerBucket[static_cast<int>(ExpressionNode::Type::Rational)] == 2);
+#endif
+}
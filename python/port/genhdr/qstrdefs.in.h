@@ -370,6 +370,32 @@ Q(KEY_EE)
 Q(KEY_ANS)
 Q(KEY_EXE)
 
+// array QSTRs
+Q(array)
+Q(uarray)
+Q(div)
+Q(dot)
+Q(linspace)
+Q(load)
+Q(mean)
+Q(mul)
+Q(save)
+Q(sub)
+
+// gc QSTRs
+Q(gc)
+Q(collect)
+Q(collect_us)
+Q(collections)
+Q(current)
+Q(free)
+Q(heap)
+Q(mem_alloc)
+Q(mem_free)
+Q(reset_stats)
+Q(sampled_peak)
+Q(stats)
+
 // Kandinsky QSTRs
 Q(kandinsky)
 Q(color)
@@ -0,0 +1,414 @@
+extern "C" {
+#include "modarray.h"
+#include <py/binary.h>
+#include <py/builtin.h>
+#include <py/mperrno.h>
+#include <py/objarray.h>
+#include <py/runtime.h>
+}
+#include <ion/storage/file_system.h>
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+
+/* The array module exposes MicroPython's array type, whose items are stored
+ * unboxed in a single buffer, along with elementwise operations and reductions
+ * computed in C. Items are read and written as doubles, without allocating an
+ * object on the heap for each of them.
+ * sum, min and max are meant to be imported with "from array import *": they
+ * defer to the builtins of the same name when not given a single array. */
+
+// Private helpers
+
+static bool isFloatTypecode(char typecode) {
+  return typecode == 'f' || typecode == 'd';
+}
+
+static mp_obj_array_t * arrayFromObject(mp_obj_t o) {
+  if (!modarray_is_typed_array(o)) {
+    mp_raise_TypeError("array expected");
+  }
+  return static_cast<mp_obj_array_t *>(MP_OBJ_TO_PTR(o));
+}
+
+static double valueAtIndex(const mp_obj_array_t * array, size_t index) {
+  const void * items = array->items;
+  switch (array->typecode) {
+    case 'b':
+      return static_cast<const int8_t *>(items)[index];
+    case 'B':
+      return static_cast<const uint8_t *>(items)[index];
+    case 'h':
+      return static_cast<const int16_t *>(items)[index];
+    case 'H':
+      return static_cast<const uint16_t *>(items)[index];
+    case 'i':
+      return static_cast<const int *>(items)[index];
+    case 'I':
+      return static_cast<const unsigned int *>(items)[index];
+    case 'l':
+      return static_cast<const long *>(items)[index];
+    case 'L':
+      return static_cast<const unsigned long *>(items)[index];
+    case 'q':
+      return static_cast<const long long *>(items)[index];
+    case 'Q':
+      return static_cast<const unsigned long long *>(items)[index];
+    case 'f':
+      return static_cast<const float *>(items)[index];
+    default:
+      assert(array->typecode == 'd');
+      return static_cast<const double *>(items)[index];
+  }
+}
+
+/* Set value to the integer item at index, without going through a double so
+ * that 64-bit items stay exact. Return false if the item does not fit. */
+static bool integerValueAtIndex(const mp_obj_array_t * array, size_t index, long long * value) {
+  const void * items = array->items;
+  unsigned long long unsignedValue;
+  switch (array->typecode) {
+    case 'b':
+      *value = static_cast<const int8_t *>(items)[index];
+      return true;
+    case 'B':
+      *value = static_cast<const uint8_t *>(items)[index];
+      return true;
+    case 'h':
+      *value = static_cast<const int16_t *>(items)[index];
+      return true;
+    case 'H':
+      *value = static_cast<const uint16_t *>(items)[index];
+      return true;
+    case 'i':
+      *value = static_cast<const int *>(items)[index];
+      return true;
+    case 'I':
+      *value = static_cast<const unsigned int *>(items)[index];
+      return true;
+    case 'l':
+      *value = static_cast<const long *>(items)[index];
+      return true;
+    case 'L':
+      unsignedValue = static_cast<const unsigned long *>(items)[index];
+      break;
+    case 'q':
+      *value = static_cast<const long long *>(items)[index];
+      return true;
+    default:
+      assert(array->typecode == 'Q');
+      unsignedValue = static_cast<const unsigned long long *>(items)[index];
+  }
+  if (unsignedValue > static_cast<unsigned long long>(LLONG_MAX)) {
+    return false;
+  }
+  *value = unsignedValue;
+  return true;
+}
+
+static void setValueAtIndex(mp_obj_array_t * array, size_t index, double value) {
+  void * items = array->items;
+  switch (array->typecode) {
+    case 'f':
+      static_cast<float *>(items)[index] = value;
+      return;
+    case 'd':
+      static_cast<double *>(items)[index] = value;
+      return;
+    default:
+    {
+      /* Integers are truncated and wrapped like in C, provided they fit in a
+       * mp_int_t or a mp_uint_t, since converting a double that does not is
+       * undefined. */
+      constexpr double bound = static_cast<double>(static_cast<mp_uint_t>(1) << (8 * sizeof(mp_int_t) - 1));
+      if (!(value > -bound - 1.0 && value < 2.0 * bound)) {
+        mp_raise_msg(&mp_type_OverflowError, MP_ERROR_TEXT("value out of range"));
+      }
+      mp_int_t integer = value < bound ? static_cast<mp_int_t>(value) : static_cast<mp_int_t>(static_cast<mp_uint_t>(value));
+      mp_binary_set_val_array_from_int(array->typecode, items, index, integer);
+    }
+  }
+}
+
+static mp_obj_array_t * newArray(char typecode, size_t length) {
+  mp_obj_array_t * array = m_new_obj(mp_obj_array_t);
+  array->base.type = &mp_type_array;
+  array->typecode = typecode;
+  array->free = 0;
+  array->len = length;
+  array->items = m_new(byte, mp_binary_get_size('@', typecode, nullptr) * length);
+  return array;
+}
+
+enum class Operation {
+  Addition,
+  Subtraction,
+  Multiplication,
+  Division
+};
+
+/* Apply the operation between each item of a and either the item of b at the
+ * same index if b is an array, or b itself if it is a scalar. The result keeps
+ * the typecode of a, unless its items cannot hold the result exactly. */
+static mp_obj_t elementwise(mp_obj_t a, mp_obj_t b, Operation operation) {
+  mp_obj_array_t * arrayA = arrayFromObject(a);
+  mp_obj_array_t * arrayB = nullptr;
+  double scalarB = 0.0;
+  char typecode = arrayA->typecode;
+  if (modarray_is_typed_array(b)) {
+    arrayB = arrayFromObject(b);
+    if (arrayB->len != arrayA->len) {
+      mp_raise_ValueError("arrays must be the same size");
+    }
+    if (!isFloatTypecode(typecode) && isFloatTypecode(arrayB->typecode)) {
+      typecode = arrayB->typecode;
+    } else if (typecode == 'f' && arrayB->typecode == 'd') {
+      typecode = 'd';
+    }
+  } else {
+    scalarB = mp_obj_get_float(b);
+    if (!isFloatTypecode(typecode) && mp_obj_is_float(b)) {
+      typecode = 'd';
+    }
+  }
+  if (operation == Operation::Division && !isFloatTypecode(typecode)) {
+    typecode = 'd';
+  }
+  size_t length = arrayA->len;
+  mp_obj_array_t * result = newArray(typecode, length);
+  for (size_t i = 0; i < length; i++) {
+    double x = valueAtIndex(arrayA, i);
+    double y = arrayB ? valueAtIndex(arrayB, i) : scalarB;
+    double value;
+    switch (operation) {
+      case Operation::Addition:
+        value = x + y;
+        break;
+      case Operation::Subtraction:
+        value = x - y;
+        break;
+      case Operation::Multiplication:
+        value = x * y;
+        break;
+      default:
+        assert(operation == Operation::Division);
+        value = x / y;
+    }
+    setValueAtIndex(result, i, value);
+  }
+  return MP_OBJ_FROM_PTR(result);
+}
+
+static mp_obj_array_t * nonEmptyArrayFromObject(mp_obj_t o) {
+  mp_obj_array_t * array = arrayFromObject(o);
+  if (array->len == 0) {
+    mp_raise_ValueError("empty array");
+  }
+  return array;
+}
+
+/* Sum of the integer items of a, or of their products with the items of b if
+ * b is not null. Items are accumulated in 64 bits and, once the result does
+ * not fit anymore, as arbitrary precision integers, so that it stays exact. It
+ * is returned as an integer like Python's builtins would. */
+static mp_obj_t integerReduction(const mp_obj_array_t * a, const mp_obj_array_t * b) {
+  assert(!isFloatTypecode(a->typecode) && (b == nullptr || !isFloatTypecode(b->typecode)));
+  long long result = 0;
+  size_t i = 0;
+  for (; i < a->len; i++) {
+    long long x, y = 1, next;
+    if (!integerValueAtIndex(a, i, &x)
+        || (b && !integerValueAtIndex(b, i, &y))
+        || __builtin_mul_overflow(x, y, &x)
+        || __builtin_add_overflow(result, x, &next)) {
+      break;
+    }
+    result = next;
+  }
+  mp_obj_t bigResult = mp_obj_new_int_from_ll(result);
+  for (; i < a->len; i++) {
+    mp_obj_t term = mp_binary_get_val_array(a->typecode, a->items, i);
+    if (b) {
+      term = mp_binary_op(MP_BINARY_OP_MULTIPLY, term, mp_binary_get_val_array(b->typecode, b->items, i));
+    }
+    bigResult = mp_binary_op(MP_BINARY_OP_ADD, bigResult, term);
+  }
+  return bigResult;
+}
+
+// Public helpers
+
+bool modarray_is_typed_array(mp_obj_t o) {
+  return mp_obj_is_type(o, &mp_type_array);
+}
+
+mp_obj_t modarray_copy(mp_obj_t array) {
+  mp_obj_array_t * a = arrayFromObject(array);
+  mp_obj_array_t * copy = newArray(a->typecode, a->len);
+  memcpy(copy->items, a->items, mp_binary_get_size('@', a->typecode, nullptr) * a->len);
+  return MP_OBJ_FROM_PTR(copy);
+}
+
+mp_float_t modarray_value_at(mp_obj_t array, size_t index) {
+  mp_obj_array_t * a = static_cast<mp_obj_array_t *>(MP_OBJ_TO_PTR(array));
+  assert(index < a->len);
+  return valueAtIndex(a, index);
+}
+
+// Module functions
+
+mp_obj_t modarray_add(mp_obj_t a, mp_obj_t b) {
+  return elementwise(a, b, Operation::Addition);
+}
+
+mp_obj_t modarray_sub(mp_obj_t a, mp_obj_t b) {
+  return elementwise(a, b, Operation::Subtraction);
+}
+
+mp_obj_t modarray_mul(mp_obj_t a, mp_obj_t b) {
+  return elementwise(a, b, Operation::Multiplication);
+}
+
+mp_obj_t modarray_div(mp_obj_t a, mp_obj_t b) {
+  return elementwise(a, b, Operation::Division);
+}
+
+mp_obj_t modarray_sum(size_t n_args, const mp_obj_t *args) {
+  if (n_args != 1 || !modarray_is_typed_array(args[0])) {
+    return mp_builtin_sum_obj.fun.var(n_args, args);
+  }
+  mp_obj_array_t * array = arrayFromObject(args[0]);
+  if (!isFloatTypecode(array->typecode)) {
+    return integerReduction(array, nullptr);
+  }
+  double sum = 0.0;
+  for (size_t i = 0; i < array->len; i++) {
+    sum += valueAtIndex(array, i);
+  }
+  return mp_obj_new_float(sum);
+}
+
+mp_obj_t modarray_mean(mp_obj_t a) {
+  mp_obj_array_t * array = nonEmptyArrayFromObject(a);
+  double sum = 0.0;
+  for (size_t i = 0; i < array->len; i++) {
+    sum += valueAtIndex(array, i);
+  }
+  return mp_obj_new_float(sum / array->len);
+}
+
+static mp_obj_t extremum(mp_obj_t a, bool maximum) {
+  mp_obj_array_t * array = nonEmptyArrayFromObject(a);
+  size_t extremumIndex = 0;
+  double extremumValue = valueAtIndex(array, 0);
+  for (size_t i = 1; i < array->len; i++) {
+    double value = valueAtIndex(array, i);
+    // NAN values are ignored, unless the array only holds NAN values
+    if (isnan(extremumValue) || (maximum ? value > extremumValue : value < extremumValue)) {
+      extremumIndex = i;
+      extremumValue = value;
+    }
+  }
+  return mp_binary_get_val_array(array->typecode, array->items, extremumIndex);
+}
+
+mp_obj_t modarray_min(size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+  if (n_args != 1 || kw_args->used > 0 || !modarray_is_typed_array(args[0])) {
+    return mp_builtin_min_obj.fun.kw(n_args, args, kw_args);
+  }
+  return extremum(args[0], false);
+}
+
+mp_obj_t modarray_max(size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+  if (n_args != 1 || kw_args->used > 0 || !modarray_is_typed_array(args[0])) {
+    return mp_builtin_max_obj.fun.kw(n_args, args, kw_args);
+  }
+  return extremum(args[0], true);
+}
+
+mp_obj_t modarray_dot(mp_obj_t a, mp_obj_t b) {
+  mp_obj_array_t * arrayA = arrayFromObject(a);
+  mp_obj_array_t * arrayB = arrayFromObject(b);
+  if (arrayA->len != arrayB->len) {
+    mp_raise_ValueError("arrays must be the same size");
+  }
+  if (!isFloatTypecode(arrayA->typecode) && !isFloatTypecode(arrayB->typecode)) {
+    return integerReduction(arrayA, arrayB);
+  }
+  double dot = 0.0;
+  for (size_t i = 0; i < arrayA->len; i++) {
+    dot += valueAtIndex(arrayA, i) * valueAtIndex(arrayB, i);
+  }
+  return mp_obj_new_float(dot);
+}
+
+/* linspace(start, stop, num=50)
+ * Returns an array of num evenly spaced doubles from start to stop included */
+
+mp_obj_t modarray_linspace(size_t n_args, const mp_obj_t *args) {
+  double start = mp_obj_get_float(args[0]);
+  double stop = mp_obj_get_float(args[1]);
+  mp_int_t length = n_args > 2 ? mp_obj_get_int(args[2]) : 50;
+  if (length < 0) {
+    mp_raise_ValueError("number of samples must be non-negative");
+  }
+  mp_obj_array_t * result = newArray('d', length);
+  double step = length > 1 ? (stop - start) / (length - 1) : 0.0;
+  for (mp_int_t i = 0; i < length; i++) {
+    setValueAtIndex(result, i, (i > 0 && i == length - 1) ? stop : start + i * step);
+  }
+  return MP_OBJ_FROM_PTR(result);
+}
+
+/* save(name, values)
+ * Stores an array or a list of numbers in the binary list record name.bls.
+ * The apps handling lists of values import it into the list of the same name,
+ * and then remove it. */
+
+mp_obj_t modarray_save(mp_obj_t name, mp_obj_t values) {
+  const char * baseName = mp_obj_str_get_str(name);
+  if (baseName[0] == 0 || strchr(baseName, Ion::Storage::Record::k_dotChar) != nullptr) {
+    mp_raise_ValueError("invalid name");
+  }
+  mp_obj_array_t * array;
+  if (modarray_is_typed_array(values) && arrayFromObject(values)->typecode == 'd') {
+    // The items are already laid out as in the record
+    array = arrayFromObject(values);
+  } else {
+    size_t length;
+    mp_obj_t * items = nullptr;
+    if (modarray_is_typed_array(values)) {
+      length = arrayFromObject(values)->len;
+    } else {
+      mp_obj_get_array(values, &length, &items);
+    }
+    array = newArray('d', length);
+    for (size_t i = 0; i < length; i++) {
+      setValueAtIndex(array, i, items ? mp_obj_get_float(items[i]) : valueAtIndex(arrayFromObject(values), i));
+    }
+  }
+  Ion::Storage::Record::ErrorStatus error = Ion::Storage::FileSystem::sharedFileSystem()->createRecordWithExtension(baseName, Ion::Storage::blsExtension, array->items, array->len * sizeof(double), true);
+  switch (error) {
+    case Ion::Storage::Record::ErrorStatus::None:
+      return mp_const_none;
+    case Ion::Storage::Record::ErrorStatus::NotEnoughSpaceAvailable:
+      mp_raise_OSError(MP_ENOSPC);
+    default:
+      mp_raise_ValueError("invalid name");
+  }
+}
+
+/* load(name)
+ * Returns the content of the binary list record name.bls as an array of
+ * doubles */
+
+mp_obj_t modarray_load(mp_obj_t name) {
+  Ion::Storage::Record record = Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtension(mp_obj_str_get_str(name), Ion::Storage::blsExtension);
+  if (record.isNull()) {
+    mp_raise_OSError(MP_ENOENT);
+  }
+  Ion::Storage::Record::Data data = record.value();
+  mp_obj_array_t * array = newArray('d', data.size / sizeof(double));
+  memcpy(array->items, data.buffer, array->len * sizeof(double));
+  return MP_OBJ_FROM_PTR(array);
+}
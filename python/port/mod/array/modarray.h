@@ -0,0 +1,19 @@
+#include <py/obj.h>
+
+mp_obj_t modarray_add(mp_obj_t a, mp_obj_t b);
+mp_obj_t modarray_sub(mp_obj_t a, mp_obj_t b);
+mp_obj_t modarray_mul(mp_obj_t a, mp_obj_t b);
+mp_obj_t modarray_div(mp_obj_t a, mp_obj_t b);
+mp_obj_t modarray_sum(size_t n_args, const mp_obj_t *args);
+mp_obj_t modarray_mean(mp_obj_t a);
+mp_obj_t modarray_min(size_t n_args, const mp_obj_t *args, mp_map_t *kw_args);
+mp_obj_t modarray_max(size_t n_args, const mp_obj_t *args, mp_map_t *kw_args);
+mp_obj_t modarray_dot(mp_obj_t a, mp_obj_t b);
+mp_obj_t modarray_linspace(size_t n_args, const mp_obj_t *args);
+mp_obj_t modarray_save(mp_obj_t name, mp_obj_t values);
+mp_obj_t modarray_load(mp_obj_t name);
+
+// Helpers shared with the other modules reading typed arrays
+bool modarray_is_typed_array(mp_obj_t o);
+mp_obj_t modarray_copy(mp_obj_t array);
+mp_float_t modarray_value_at(mp_obj_t array, size_t index);
@@ -0,0 +1,38 @@
+#include "modarray.h"
+
+MP_DEFINE_CONST_FUN_OBJ_2(modarray_add_obj, modarray_add);
+MP_DEFINE_CONST_FUN_OBJ_2(modarray_sub_obj, modarray_sub);
+MP_DEFINE_CONST_FUN_OBJ_2(modarray_mul_obj, modarray_mul);
+MP_DEFINE_CONST_FUN_OBJ_2(modarray_div_obj, modarray_div);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modarray_sum_obj, 1, 2, modarray_sum);
+MP_DEFINE_CONST_FUN_OBJ_1(modarray_mean_obj, modarray_mean);
+MP_DEFINE_CONST_FUN_OBJ_KW(modarray_min_obj, 1, modarray_min);
+MP_DEFINE_CONST_FUN_OBJ_KW(modarray_max_obj, 1, modarray_max);
+MP_DEFINE_CONST_FUN_OBJ_2(modarray_dot_obj, modarray_dot);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modarray_linspace_obj, 2, 3, modarray_linspace);
+MP_DEFINE_CONST_FUN_OBJ_2(modarray_save_obj, modarray_save);
+MP_DEFINE_CONST_FUN_OBJ_1(modarray_load_obj, modarray_load);
+
+STATIC const mp_rom_map_elem_t modarray_module_globals_table[] = {
+  { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_array) },
+  { MP_ROM_QSTR(MP_QSTR_array), MP_ROM_PTR(&mp_type_array) },
+  { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&modarray_add_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sub), MP_ROM_PTR(&modarray_sub_obj) },
+  { MP_ROM_QSTR(MP_QSTR_mul), MP_ROM_PTR(&modarray_mul_obj) },
+  { MP_ROM_QSTR(MP_QSTR_div), MP_ROM_PTR(&modarray_div_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&modarray_sum_obj) },
+  { MP_ROM_QSTR(MP_QSTR_mean), MP_ROM_PTR(&modarray_mean_obj) },
+  { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&modarray_min_obj) },
+  { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&modarray_max_obj) },
+  { MP_ROM_QSTR(MP_QSTR_dot), MP_ROM_PTR(&modarray_dot_obj) },
+  { MP_ROM_QSTR(MP_QSTR_linspace), MP_ROM_PTR(&modarray_linspace_obj) },
+  { MP_ROM_QSTR(MP_QSTR_save), MP_ROM_PTR(&modarray_save_obj) },
+  { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&modarray_load_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(modarray_module_globals, modarray_module_globals_table);
+
+const mp_obj_module_t modarray_module = {
+  .base = { &mp_type_module },
+  .globals = (mp_obj_dict_t*)&modarray_module_globals,
+};
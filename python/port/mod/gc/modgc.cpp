@@ -0,0 +1,54 @@
+extern "C" {
+#include "modgc.h"
+#include <py/gc.h>
+#include <py/runtime.h>
+}
+#include "../../port.h"
+
+/* The gc module is only built on the simulator, to help sizing the heap needed
+ * by a script. It mirrors the functions of MicroPython's own gc module and adds
+ * statistics gathered by the port on each collection.
+ * mem_alloc and "current" are the bytes allocated right now. The allocator
+ * does not track its peak, so "sampled_peak" is the highest usage seen before
+ * a collection or when the statistics were read: a short-lived allocation
+ * between two samples is missed. */
+
+mp_obj_t modgc_collect() {
+  gc_collect();
+  return mp_const_none;
+}
+
+mp_obj_t modgc_mem_alloc() {
+  gc_info_t info;
+  gc_info(&info);
+  return mp_obj_new_int_from_uint(info.used);
+}
+
+mp_obj_t modgc_mem_free() {
+  gc_info_t info;
+  gc_info(&info);
+  return mp_obj_new_int_from_uint(info.free);
+}
+
+static void storeStatistic(mp_obj_t dict, qstr key, uint64_t value) {
+  mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(key), mp_obj_new_int_from_ull(value));
+}
+
+mp_obj_t modgc_stats() {
+  gc_info_t info;
+  gc_info(&info);
+  MicroPython::GCStatistics statistics = MicroPython::gcStatistics();
+  mp_obj_t dict = mp_obj_new_dict(6);
+  storeStatistic(dict, MP_QSTR_heap, info.total);
+  storeStatistic(dict, MP_QSTR_current, info.used);
+  storeStatistic(dict, MP_QSTR_free, info.free);
+  storeStatistic(dict, MP_QSTR_sampled_peak, statistics.sampledPeakUsedBytes);
+  storeStatistic(dict, MP_QSTR_collections, statistics.numberOfCollections);
+  storeStatistic(dict, MP_QSTR_collect_us, statistics.collectionsDuration);
+  return dict;
+}
+
+mp_obj_t modgc_reset_stats() {
+  MicroPython::resetGCStatistics();
+  return mp_const_none;
+}
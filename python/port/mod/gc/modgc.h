@@ -0,0 +1,7 @@
+#include <py/obj.h>
+
+mp_obj_t modgc_collect();
+mp_obj_t modgc_mem_alloc();
+mp_obj_t modgc_mem_free();
+mp_obj_t modgc_stats();
+mp_obj_t modgc_reset_stats();
@@ -0,0 +1,23 @@
+#include "modgc.h"
+
+MP_DEFINE_CONST_FUN_OBJ_0(modgc_collect_obj, modgc_collect);
+MP_DEFINE_CONST_FUN_OBJ_0(modgc_mem_alloc_obj, modgc_mem_alloc);
+MP_DEFINE_CONST_FUN_OBJ_0(modgc_mem_free_obj, modgc_mem_free);
+MP_DEFINE_CONST_FUN_OBJ_0(modgc_stats_obj, modgc_stats);
+MP_DEFINE_CONST_FUN_OBJ_0(modgc_reset_stats_obj, modgc_reset_stats);
+
+STATIC const mp_rom_map_elem_t modgc_module_globals_table[] = {
+  { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
+  { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&modgc_collect_obj) },
+  { MP_ROM_QSTR(MP_QSTR_mem_alloc), MP_ROM_PTR(&modgc_mem_alloc_obj) },
+  { MP_ROM_QSTR(MP_QSTR_mem_free), MP_ROM_PTR(&modgc_mem_free_obj) },
+  { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&modgc_stats_obj) },
+  { MP_ROM_QSTR(MP_QSTR_reset_stats), MP_ROM_PTR(&modgc_reset_stats_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(modgc_module_globals, modgc_module_globals_table);
+
+const mp_obj_module_t modgc_module = {
+  .base = { &mp_type_module },
+  .globals = (mp_obj_dict_t*)&modgc_module_globals,
+};
@@ -1,5 +1,6 @@
 extern "C" {
 #include "modpyplot.h"
+#include "../../array/modarray.h"
 }
 #include <assert.h>
 #include <escher/palette.h>
@@ -18,6 +19,12 @@ static size_t extractArgument(mp_obj_t arg, mp_obj_t ** items) {
   size_t itemLength;
   if (mp_obj_is_type(arg, &mp_type_tuple) || mp_obj_is_type(arg, &mp_type_list)) {
     mp_obj_get_array(arg, &itemLength, items);
+  } else if (modarray_is_typed_array(arg)) {
+    itemLength = mp_obj_get_int(mp_obj_len(arg));
+    *items = m_new(mp_obj_t, itemLength);
+    for (size_t i = 0; i < itemLength; i++) {
+      (*items)[i] = mp_obj_new_float(modarray_value_at(arg, i));
+    }
   } else {
     itemLength = 1;
     *items = m_new(mp_obj_t, 1);
@@ -365,9 +372,17 @@ mp_obj_t modpyplot_scatter(size_t n_args, const mp_obj_t *args, mp_map_t* kw_arg
     nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,"scatter() takes 2 positional arguments but %d were given",n_args));
   }
   sPlotStore->setShow(true);
-  mp_obj_t * xItems, * yItems;
   assert(n_args >= 2);
-  size_t length = extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
+  bool typedArrays = modarray_is_typed_array(args[0]) && modarray_is_typed_array(args[1]);
+  mp_obj_t * xItems, * yItems;
+  size_t length = 0;
+  if (typedArrays) {
+    if (!mp_obj_equal(mp_obj_len(args[0]), mp_obj_len(args[1]))) {
+      mp_raise_ValueError("x and y must be the same size");
+    }
+  } else {
+    length = extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
+  }
 
   // Setting scatter color
   // color keyword
@@ -379,6 +394,10 @@ mp_obj_t modpyplot_scatter(size_t n_args, const mp_obj_t *args, mp_map_t* kw_arg
   elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_color), MP_MAP_LOOKUP);
   colorFromKeywordArgument(elem, &color);
 
+  if (typedArrays) {
+    sPlotStore->addCurve(args[0], args[1], color, false);
+    return mp_const_none;
+  }
   for (size_t i=0; i<length; i++) {
     sPlotStore->addDot(xItems[i], yItems[i], color);
   }
@@ -396,9 +415,16 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,mp_map_t* kw_args) {
   if (n_args > 3) {
     nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,"plot() takes 3 positional arguments but %d were given",n_args));
   }
+  /* Typed arrays are referenced as a whole by the store rather than split into
+   * segments. */
+  bool typedArrays = modarray_is_typed_array(args[n_args == 1 ? 0 : 1]) && (n_args == 1 || modarray_is_typed_array(args[0]));
   mp_obj_t * xItems, * yItems;
-  size_t length;
-  if (n_args == 1) {
+  size_t length = 0;
+  if (typedArrays) {
+    if (n_args >= 2 && !mp_obj_equal(mp_obj_len(args[0]), mp_obj_len(args[1]))) {
+      mp_raise_ValueError("x and y must be the same size");
+    }
+  } else if (n_args == 1) {
     length = extractArgument(args[0], &yItems);
 
     // Create the default xItems: [0, 1, 2,...]
@@ -425,6 +451,10 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,mp_map_t* kw_args) {
     color = MicroPython::Color::Parse(args[2]);
   }
 
+  if (typedArrays) {
+    sPlotStore->addCurve(n_args == 1 ? mp_const_none : args[0], args[n_args == 1 ? 0 : 1], color, true);
+    return mp_const_none;
+  }
   for (int i=0; i<(int)length-1; i++) {
     sPlotStore->addSegment(xItems[i], yItems[i], xItems[i+1], yItems[i+1], color);
   }
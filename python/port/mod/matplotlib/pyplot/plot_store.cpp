@@ -1,5 +1,8 @@
 #include "plot_store.h"
 #include <algorithm>
+extern "C" {
+#include "../../array/modarray.h"
+}
 
 namespace Matplotlib {
 
@@ -14,6 +17,7 @@ void PlotStore::flush() {
   m_segments = mp_obj_new_list(0, nullptr);
   m_rects = mp_obj_new_list(0, nullptr);
   m_labels = mp_obj_new_list(0, nullptr);
+  m_curves = mp_obj_new_list(0, nullptr);
   m_axesRequested = true;
   m_axesAuto = true;
   m_gridRequested = false;
@@ -140,6 +144,39 @@ void PlotStore::addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string) {
   mp_obj_list_append(m_labels, tuple);
 }
 
+// Curve
+
+template class PlotStore::ListIterator<PlotStore::Curve>;
+
+PlotStore::Curve::Curve(mp_obj_t tuple) {
+  mp_obj_t * elements;
+  mp_obj_get_array_fixed_n(tuple, 4, &elements);
+  m_x = elements[0];
+  m_y = elements[1];
+  m_joinPoints = mp_obj_is_true(elements[2]);
+  m_color = KDColor::RGB16(mp_obj_get_int(elements[3]));
+  m_numberOfPoints = mp_obj_get_int(mp_obj_len(m_y));
+  assert(m_x == mp_const_none || static_cast<size_t>(mp_obj_get_int(mp_obj_len(m_x))) == m_numberOfPoints);
+}
+
+float PlotStore::Curve::xAtIndex(size_t i) const {
+  return m_x == mp_const_none ? static_cast<float>(i) : modarray_value_at(m_x, i);
+}
+
+float PlotStore::Curve::yAtIndex(size_t i) const {
+  return modarray_value_at(m_y, i);
+}
+
+void PlotStore::addCurve(mp_obj_t x, mp_obj_t y, KDColor c, bool joinPoints) {
+  assert((x == mp_const_none || modarray_is_typed_array(x)) && modarray_is_typed_array(y));
+  /* The arrays are copied so that the curve drawn by show() is the one that was
+   * plotted, even if the script modified the arrays in the meantime. */
+  mp_obj_t color = mp_obj_new_int(c);
+  mp_obj_t items[4] = {x == mp_const_none ? x : modarray_copy(x), modarray_copy(y), mp_obj_new_bool(joinPoints), color};
+  mp_obj_t tuple = mp_obj_new_tuple(4, items);
+  mp_obj_list_append(m_curves, tuple);
+}
+
 // Axes
 
 void updateRange(float * xMin, float * xMax, float * yMin, float * yMax, float x, float y) {
@@ -186,6 +223,11 @@ void PlotStore::initRange() {
       updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.left(), rectangle.top());
       updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.right(), rectangle.bottom());
     }
+    for (PlotStore::Curve curve : curves()) {
+      for (size_t i = 0; i < curve.numberOfPoints(); i++) {
+        updateRange(&xMin, &xMax, &yMin, &yMax, curve.xAtIndex(i), curve.yAtIndex(i));
+      }
+    }
     checkPositiveRangeAndAddMargin(&xMin, &xMax);
     checkPositiveRangeAndAddMargin(&yMin, &yMax);
     setXMin(xMin);
@@ -119,6 +119,30 @@ public:
   void addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string);
   Iterable<ListIterator<Label>> labels() { return Iterable<ListIterator<Label>>(m_labels); }
 
+  // Curve
+
+  /* A curve keeps a copy of the typed arrays given to plot or scatter instead
+   * of storing a tuple for each of their points. Its points are either joined
+   * by segments or drawn as dots. */
+  class Curve {
+  public:
+    Curve(mp_obj_t tuple);
+    size_t numberOfPoints() const { return m_numberOfPoints; }
+    float xAtIndex(size_t i) const;
+    float yAtIndex(size_t i) const;
+    bool joinPoints() const { return m_joinPoints; }
+    KDColor color() const { return m_color; }
+  private:
+    mp_obj_t m_x; // None if the abscissas are the indexes
+    mp_obj_t m_y;
+    size_t m_numberOfPoints;
+    bool m_joinPoints;
+    KDColor m_color;
+  };
+
+  void addCurve(mp_obj_t x, mp_obj_t y, KDColor c, bool joinPoints);
+  Iterable<ListIterator<Curve>> curves() { return Iterable<ListIterator<Curve>>(m_curves); }
+
   void setAxesRequested(bool b) { m_axesRequested = b; }
   bool axesRequested() const { return m_axesRequested; }
   void setAxesAuto(bool b) { m_axesAuto = b; }
@@ -133,6 +157,7 @@ private:
   mp_obj_t m_labels; // List of (x, y, string)
   mp_obj_t m_segments; // List of (x, y, dx, dy, style, color)
   mp_obj_t m_rects; // List of (x, y, w, h, color)
+  mp_obj_t m_curves; // List of (x, y, joinPoints, color)
   bool m_axesRequested;
   bool m_axesAuto;
   bool m_gridRequested;
@@ -38,6 +38,9 @@ void PyplotPolicy::drawPlot(const AbstractPlotView * plotView, KDContext * ctx,
     for (PlotStore::Rect rectangle : m_store->rects()) {
       traceRect(plotView, ctx, rect, rectangle);
     }
+    for (PlotStore::Curve curve : m_store->curves()) {
+      traceCurve(plotView, ctx, rect, curve);
+    }
     nlr_pop();
   } else { // Uncaught exception
     MicroPython::ExecutionEnvironment::HandleException(&nlr, m_micropythonEnvironment);
@@ -75,6 +78,26 @@ void PyplotPolicy::traceLabel(const AbstractPlotView * plotView, KDContext * ctx
   plotView->drawLabel(ctx, r, label.string(), Coordinate2D<float>(label.x(), label.y()), AbstractPlotView::RelativePosition::After, AbstractPlotView::RelativePosition::After, KDColorBlack);
 }
 
+void PyplotPolicy::traceCurve(const AbstractPlotView * plotView, KDContext * ctx, KDRect r, PlotStore::Curve curve) const {
+  size_t numberOfPoints = curve.numberOfPoints();
+  if (numberOfPoints == 0) {
+    return;
+  }
+  Coordinate2D<float> previousPoint(curve.xAtIndex(0), curve.yAtIndex(0));
+  if (!curve.joinPoints()) {
+    plotView->drawDot(ctx, r, Dots::Size::Tiny, previousPoint, curve.color());
+  }
+  for (size_t i = 1; i < numberOfPoints; i++) {
+    Coordinate2D<float> point(curve.xAtIndex(i), curve.yAtIndex(i));
+    if (curve.joinPoints()) {
+      plotView->drawSegment(ctx, r, previousPoint, point, curve.color(), true);
+    } else {
+      plotView->drawDot(ctx, r, Dots::Size::Tiny, point, curve.color());
+    }
+    previousPoint = point;
+  }
+}
+
 // PyplotView
 
 PyplotView::PyplotView(PlotStore * s) :
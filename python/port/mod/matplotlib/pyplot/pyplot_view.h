@@ -31,6 +31,7 @@ protected:
   void traceSegment(const Shared::AbstractPlotView * plotView, KDContext * ctx, KDRect r, PlotStore::Segment segment) const;
   void traceRect(const Shared::AbstractPlotView * plotView, KDContext * ctx, KDRect r, PlotStore::Rect rect) const;
   void traceLabel(const Shared::AbstractPlotView * plotView, KDContext * ctx, KDRect r, PlotStore::Label label) const;
+  void traceCurve(const Shared::AbstractPlotView * plotView, KDContext * ctx, KDRect r, PlotStore::Curve curve) const;
 
   PlotStore * m_store;
   MicroPython::ExecutionEnvironment * m_micropythonEnvironment;
@@ -72,7 +72,8 @@
 // Whether to provide "array" module. Note that large chunk of the
 // underlying code is shared with "bytearray" builtin type, so to
 // get real savings, it should be disabled too.
-#define MICROPY_PY_ARRAY (0)
+// The array type is exposed by our own array module.
+#define MICROPY_PY_ARRAY (1)
 
 // Whether to support attrtuple type (MicroPython extension)
 // It provides space-efficient tuples with attribute access
@@ -135,6 +136,7 @@ typedef long mp_off_t;
 
 #define MP_STATE_PORT MP_STATE_VM
 
+extern const struct _mp_obj_module_t modarray_module;
 extern const struct _mp_obj_module_t modion_module;
 extern const struct _mp_obj_module_t modkandinsky_module;
 extern const struct _mp_obj_module_t modmatplotlib_module;
@@ -142,7 +144,19 @@ extern const struct _mp_obj_module_t modpyplot_module;
 extern const struct _mp_obj_module_t modtime_module;
 extern const struct _mp_obj_module_t modturtle_module;
 
+// Garbage collection statistics and the gc module are only on the simulator
+#if PLATFORM_DEVICE
+#define MP_PORT_GC_STATISTICS (0)
+#define MP_PORT_GC_BUILTIN_MODULE
+#else
+#define MP_PORT_GC_STATISTICS (1)
+extern const struct _mp_obj_module_t modgc_module;
+#define MP_PORT_GC_BUILTIN_MODULE { MP_ROM_QSTR(MP_QSTR_gc), MP_ROM_PTR(&modgc_module) },
+#endif
+
 #define MICROPY_PORT_BUILTIN_MODULES \
+    MP_PORT_GC_BUILTIN_MODULE \
+    { MP_ROM_QSTR(MP_QSTR_array), MP_ROM_PTR(&modarray_module) }, \
     { MP_ROM_QSTR(MP_QSTR_ion), MP_ROM_PTR(&modion_module) }, \
     { MP_ROM_QSTR(MP_QSTR_kandinsky), MP_ROM_PTR(&modkandinsky_module) }, \
     { MP_ROM_QSTR(MP_QSTR_matplotlib), MP_ROM_PTR(&modmatplotlib_module) }, \
@@ -174,6 +174,9 @@ void MicroPython::init(void * heapStart, void * heapEnd) {
 #endif
   gc_init(heapStart, heapEnd);
   mp_init();
+#if MP_PORT_GC_STATISTICS
+  resetGCStatistics();
+#endif
 }
 
 void MicroPython::deinit() {
@@ -209,6 +212,28 @@ void MicroPython::collectRootsAtAddress(char * address, int byteLength) {
   gc_collect_root((void **)alignedAddress, alignedByteLength /  sizeof(uintptr_t));
 }
 
+#if MP_PORT_GC_STATISTICS
+static MicroPython::GCStatistics sGCStatistics;
+
+static void sampleUsedBytes() {
+  gc_info_t info;
+  gc_info(&info);
+  if (info.used > sGCStatistics.sampledPeakUsedBytes) {
+    sGCStatistics.sampledPeakUsedBytes = info.used;
+  }
+}
+
+MicroPython::GCStatistics MicroPython::gcStatistics() {
+  sampleUsedBytes();
+  return sGCStatistics;
+}
+
+void MicroPython::resetGCStatistics() {
+  sGCStatistics = GCStatistics();
+  sampleUsedBytes();
+}
+#endif
+
 KDColor MicroPython::Color::Parse(mp_obj_t input, Mode mode){
   constexpr static int maxColorIntensity = static_cast<int>(Mode::MaxIntensity255);
   if (mp_obj_is_str(input)) {
@@ -323,11 +348,21 @@ void gc_collect_regs_and_stack(void) {
 }
 
 void gc_collect(void) {
+#if MP_PORT_GC_STATISTICS
+  /* The heap is the fullest right before a collection, which is when the usage
+   * is sampled. */
+  sampleUsedBytes();
+  uint64_t collectionStart = Ion::Timing::micros();
+#endif
   gc_collect_start();
   modturtle_gc_collect();
   modpyplot_gc_collect();
   gc_collect_regs_and_stack();
   gc_collect_end();
+#if MP_PORT_GC_STATISTICS
+  sGCStatistics.numberOfCollections++;
+  sGCStatistics.collectionsDuration += Ion::Timing::micros() - collectionStart;
+#endif
 }
 
 void nlr_jump_fail(void *val) {
@@ -45,6 +45,17 @@ void deinit();
 void registerScriptProvider(ScriptProvider * s);
 void collectRootsAtAddress(char * address, int len);
 
+#if MP_PORT_GC_STATISTICS
+struct GCStatistics {
+  uint32_t numberOfCollections;
+  uint64_t collectionsDuration; // In microseconds
+  // Highest usage seen before a collection or when read, not the exact peak
+  size_t sampledPeakUsedBytes;
+};
+GCStatistics gcStatistics();
+void resetGCStatistics();
+#endif
+
 class Color {
 public:
   enum class Mode {
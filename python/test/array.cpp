@@ -0,0 +1,43 @@
+#include <quiz.h>
+#include <ion/storage/file_system.h>
+#include "execution_environment.h"
+
+QUIZ_CASE(python_array) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_fails(env, "array('d')");
+  assert_command_execution_succeeds(env, "from array import *");
+  assert_command_execution_succeeds(env, "a = array('d', [1, 2, 3])");
+  assert_command_execution_succeeds(env, "b = array('i', [4, 5, 6])");
+  assert_command_execution_succeeds(env, "add(a, b)", "array('d', [5.0, 7.0, 9.0])\n");
+  assert_command_execution_succeeds(env, "sub(b, 1)", "array('i', [3, 4, 5])\n");
+  assert_command_execution_succeeds(env, "mul(b, 0.5)", "array('d', [2.0, 2.5, 3.0])\n");
+  assert_command_execution_succeeds(env, "div(b, 2)", "array('d', [2.0, 2.5, 3.0])\n");
+  assert_command_execution_succeeds(env, "sum(a)", "6.0\n");
+  assert_command_execution_succeeds(env, "sum(b)", "15\n");
+  assert_command_execution_succeeds(env, "mean(b)", "5.0\n");
+  assert_command_execution_succeeds(env, "min(b)", "4\n");
+  assert_command_execution_succeeds(env, "max(a)", "3.0\n");
+  assert_command_execution_succeeds(env, "dot(a, b)", "32.0\n");
+  assert_command_execution_succeeds(env, "dot(b, b)", "77\n");
+  // Integer reductions stay exact beyond 64 bits
+  assert_command_execution_succeeds(env, "sum(array('q', [2**62, 2**62]))", "9223372036854775808\n");
+  assert_command_execution_succeeds(env, "sum(array('Q', [2**64-1, 1]))", "18446744073709551616\n");
+  assert_command_execution_succeeds(env, "dot(array('q', [2**40, 1]), array('q', [2**40, 1]))", "1208925819614629174706177\n");
+  assert_command_execution_succeeds(env, "add(array('I', [1]), 3999999999)", "array('I', [4000000000])\n");
+  assert_command_execution_fails(env, "sub(b, 2**70)");
+  assert_command_execution_succeeds(env, "linspace(0, 1, 3)", "array('d', [0.0, 0.5, 1.0])\n");
+  assert_command_execution_fails(env, "add(a, array('d', [1]))");
+  assert_command_execution_fails(env, "add([1, 2, 3], a)");
+  assert_command_execution_fails(env, "max(array('f'))");
+  assert_command_execution_succeeds(env, "save('V1', [1, 2.5])");
+  assert_command_execution_succeeds(env, "save('V1', add(load('V1'), b[:2]))");
+  assert_command_execution_succeeds(env, "load('V1')", "array('d', [5.0, 7.5])\n");
+  assert_command_execution_fails(env, "load('V2')");
+  assert_command_execution_fails(env, "save('', a)");
+  // Builtins are still reachable when the arguments are not a single array
+  assert_command_execution_succeeds(env, "sum([1, 2], 3)", "6\n");
+  assert_command_execution_succeeds(env, "max(1, 2)", "2\n");
+  assert_command_execution_succeeds(env, "min([3, 1], key=lambda x: -x)", "3\n");
+  deinit_environment();
+  Ion::Storage::FileSystem::sharedFileSystem()->destroyRecordsWithExtension(Ion::Storage::blsExtension);
+}
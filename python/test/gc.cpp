@@ -0,0 +1,16 @@
+#include <quiz.h>
+#include "execution_environment.h"
+
+QUIZ_CASE(python_gc) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import gc");
+  assert_command_execution_succeeds(env, "gc.reset_stats()");
+  assert_command_execution_succeeds(env, "l = [i for i in range(1000)]");
+  assert_command_execution_succeeds(env, "gc.collect()");
+  assert_command_execution_succeeds(env, "gc.stats()['collections'] >= 1", "True\n");
+  assert_command_execution_succeeds(env, "gc.mem_alloc() <= gc.stats()['sampled_peak']", "True\n");
+  assert_command_execution_succeeds(env, "gc.mem_alloc() + gc.mem_free() <= gc.stats()['heap']", "True\n");
+  assert_command_execution_succeeds(env, "gc.reset_stats()");
+  assert_command_execution_succeeds(env, "gc.stats()['collections']", "0\n");
+  deinit_environment();
+}
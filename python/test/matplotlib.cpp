@@ -102,8 +102,17 @@ QUIZ_CASE(python_matplotlib_pyplot_plot) {
   assert_command_execution_succeeds(env, "plot(2,3)");
   assert_command_execution_succeeds(env, "plot([2,3,4,5,6],[3,4,5,6,7])");
   assert_command_execution_succeeds(env, "plot([2,3,4,5,6],[3,4,5,6,7], color=\"g\")");
+  assert_command_execution_succeeds(env, "from array import *");
+  assert_command_execution_succeeds(env, "plot(array('f',[2,3,4,5,6]))");
+  assert_command_execution_succeeds(env, "plot(linspace(0,4,5),array('i',[3,4,5,6,7]))");
+  assert_command_execution_succeeds(env, "plot(linspace(0,4,5),[3,4,5,6,7])");
+  // Arrays modified after being plotted are drawn as they were
+  assert_command_execution_succeeds(env, "y = linspace(0,4,5)");
+  assert_command_execution_succeeds(env, "plot(y,y)");
+  assert_command_execution_succeeds(env, "y.append(5)");
   assert_command_execution_succeeds(env, "show()");
   assert_command_execution_fails(env, "plot([2,3,4,5,6],2)");
+  assert_command_execution_fails(env, "plot(linspace(0,4,5),linspace(0,4,4))");
   deinit_environment();
 }
 
@@ -113,7 +122,10 @@ QUIZ_CASE(python_matplotlib_pyplot_scatter) {
   assert_command_execution_succeeds(env, "scatter(2,3)");
   assert_command_execution_succeeds(env, "scatter([2,3,4,5,6],[3,4,5,6,7])");
   assert_command_execution_succeeds(env, "scatter([2,3,4,5,6],[3,4,5,6,7], color=(0,0,255))");
+  assert_command_execution_succeeds(env, "from array import *");
+  assert_command_execution_succeeds(env, "scatter(linspace(0,4,5),array('d',[3,4,5,6,7]))");
   assert_command_execution_succeeds(env, "show()");
+  assert_command_execution_fails(env, "scatter(linspace(0,4,5),linspace(0,4,4))");
   assert_command_execution_fails(env, "scatter([2,3,4,5,6],2)");
   assert_command_execution_fails(env, "scatter(2)");
   assert_command_execution_succeeds(env, "scatter(2,3,4)");
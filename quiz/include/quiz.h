@@ -9,13 +9,27 @@
 #define QUIZ_CASE(name) void quiz_case_##name()
 #endif
 
+/* A QUIZ_BENCH body is one iteration of a benchmark. Benchmarks are only run
+ * on the simulator with --bench, which times the body repeatedly after a
+ * warm-up. */
+#ifdef __cplusplus
+#define QUIZ_BENCH(name) extern "C" { void quiz_bench_##name();}; void quiz_bench_##name()
+#else
+#define QUIZ_BENCH(name) void quiz_bench_##name()
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 void quiz_assert(bool condition);
 void quiz_print(const char * message);
+/* Called once the running QUIZ_BENCH is over, to destroy what its body set up
+ * on the first iteration. */
+void quiz_bench_set_teardown(void (*teardown)());
 extern bool sSkipAssertions;
+// Number of failed assertions, including skipped ones
+extern int sNumberOfFailedAssertions;
 
 #ifdef __cplusplus
 }
@@ -1,12 +1,17 @@
 #include <ion.h>
 #include <stdlib.h>
 #include <quiz.h>
+#if !PLATFORM_DEVICE
+#include "report.h"
+#endif
 
 bool sSkipAssertions = false;
+int sNumberOfFailedAssertions = 0;
 
 void quiz_assert(bool condition) {
   if(!condition) {
     quiz_print("  ASSERTION FAILED");
+    sNumberOfFailedAssertions++;
     if (sSkipAssertions) {
       return;
     }
@@ -21,6 +26,7 @@ void quiz_assert(bool condition) {
     */
     while (true) {}
 #else
+    quiz_report_current_case_failed();
     abort();
 #endif
   }
@@ -0,0 +1,108 @@
+#include "bench.h"
+#include "quiz.h"
+#include "symbols.h"
+#include <ion/timing.h>
+#include <poincare/tree_pool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+constexpr static int k_numberOfWarmUpIterations = 3;
+constexpr static int k_minNumberOfSamples = 5;
+constexpr static int k_maxNumberOfSamples = 101;
+/* Iterations are batched so that a sample lasts long enough for the
+ * microsecond clock. */
+constexpr static uint64_t k_minSampleDurationUs = 200;
+constexpr static int k_maxBatchSize = 1 << 20;
+constexpr static uint64_t k_maxBenchDurationUs = 2000000;
+
+static void (*sTeardown)() = nullptr;
+
+void quiz_bench_set_teardown(void (*teardown)()) {
+  sTeardown = teardown;
+}
+
+static uint64_t timeBatch(QuizCase bench, int batchSize) {
+  uint64_t start = Ion::Timing::micros();
+  for (int i = 0; i < batchSize; i++) {
+    bench();
+  }
+  return Ion::Timing::micros() - start;
+}
+
+static void sort(uint64_t * samples, int numberOfSamples) {
+  for (int i = 1; i < numberOfSamples; i++) {
+    uint64_t sample = samples[i];
+    int j = i - 1;
+    while (j >= 0 && samples[j] > sample) {
+      samples[j + 1] = samples[j];
+      j--;
+    }
+    samples[j + 1] = sample;
+  }
+}
+
+static unsigned long long percentileNs(const uint64_t * sortedSamples, int numberOfSamples, int percent, int batchSize) {
+  int index = (numberOfSamples * percent + 99) / 100 - 1;
+  index = index < 0 ? 0 : index;
+  return sortedSamples[index] * 1000 / batchSize;
+}
+
+static void runBench(int index) {
+  QuizCase bench = quiz_benches[index];
+  int initialPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
+  quiz_assert(initialPoolSize == 0);
+
+  // Warm up caches and memoizations
+  for (int i = 0; i < k_numberOfWarmUpIterations; i++) {
+    bench();
+  }
+
+  int batchSize = 1;
+  while (batchSize < k_maxBatchSize && timeBatch(bench, batchSize) < k_minSampleDurationUs) {
+    batchSize *= 2;
+  }
+
+  uint64_t samples[k_maxNumberOfSamples];
+  int numberOfSamples = 0;
+  uint64_t benchDuration = 0;
+  while (numberOfSamples < k_maxNumberOfSamples && (numberOfSamples < k_minNumberOfSamples || benchDuration < k_maxBenchDurationUs)) {
+    samples[numberOfSamples] = timeBatch(bench, batchSize);
+    benchDuration += samples[numberOfSamples];
+    numberOfSamples++;
+  }
+  sort(samples, numberOfSamples);
+
+  constexpr int k_bufferSize = 160;
+  char buffer[k_bufferSize];
+  snprintf(buffer, k_bufferSize, "%s: median=%lluns p90=%lluns p99=%lluns samples=%d batch=%d",
+      quiz_bench_names[index],
+      percentileNs(samples, numberOfSamples, 50, batchSize),
+      percentileNs(samples, numberOfSamples, 90, batchSize),
+      percentileNs(samples, numberOfSamples, 99, batchSize),
+      numberOfSamples,
+      batchSize);
+  quiz_print(buffer);
+
+  if (sTeardown) {
+    sTeardown();
+    sTeardown = nullptr;
+  }
+  int currentPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
+  quiz_assert(initialPoolSize == currentPoolSize);
+}
+
+void quiz_run_benches(const char * filter) {
+  int numberOfBenches = 0;
+  for (int i = 0; quiz_benches[i] != NULL; i++) {
+    if (filter && strstr(quiz_bench_names[i], filter) != quiz_bench_names[i]) {
+      continue;
+    }
+    runBench(i);
+    numberOfBenches++;
+  }
+  constexpr int k_bufferSize = 40;
+  char buffer[k_bufferSize];
+  snprintf(buffer, k_bufferSize, "ALL %d BENCHMARKS FINISHED", numberOfBenches);
+  quiz_print(buffer);
+}
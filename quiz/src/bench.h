@@ -0,0 +1,8 @@
+#ifndef QUIZ_BENCH_H
+#define QUIZ_BENCH_H
+
+/* Run the QUIZ_BENCH whose names start with filter, or all of them if filter
+ * is null, and print one line of statistics per benchmark. */
+void quiz_run_benches(const char * filter);
+
+#endif
@@ -0,0 +1,129 @@
+#include "report.h"
+#include "quiz.h"
+#include "symbols.h"
+#include <assert.h>
+#include <stdio.h>
+
+struct QuizCaseResult {
+  uint64_t durationUs;
+  int caseIndex;
+  QuizCaseStatus status;
+};
+
+static QuizCaseResult sResults[k_quizReportMaxNumberOfCases];
+static int sNumberOfResults = 0;
+
+static const char * statusName(QuizCaseStatus status) {
+  switch (status) {
+  case QuizCaseStatus::Passed:
+    return "passed";
+  case QuizCaseStatus::Failed:
+    return "failed";
+  default:
+    assert(status == QuizCaseStatus::Skipped);
+    return "skipped";
+  }
+}
+
+void quiz_report_reset() {
+  sNumberOfResults = 0;
+}
+
+void quiz_report_add(int caseIndex, uint64_t durationUs, QuizCaseStatus status) {
+  if (sNumberOfResults >= k_quizReportMaxNumberOfCases) {
+    quiz_print("QUIZ REPORT IS FULL");
+    return;
+  }
+  sResults[sNumberOfResults++] = {durationUs, caseIndex, status};
+}
+
+int quiz_report_number_of_cases_with_status(QuizCaseStatus status) {
+  int count = 0;
+  for (int i = 0; i < sNumberOfResults; i++) {
+    count += sResults[i].status == status;
+  }
+  return count;
+}
+
+void quiz_report_print_failures() {
+  constexpr int k_bufferSize = 128;
+  char buffer[k_bufferSize];
+  for (int i = 0; i < sNumberOfResults; i++) {
+    if (sResults[i].status != QuizCaseStatus::Passed) {
+      snprintf(buffer, k_bufferSize, "%s: %s", statusName(sResults[i].status), quiz_case_names[sResults[i].caseIndex]);
+      quiz_print(buffer);
+    }
+  }
+}
+
+void quiz_report_print_slowest(int numberOfCases) {
+  constexpr int k_bufferSize = 128;
+  char buffer[k_bufferSize];
+  snprintf(buffer, k_bufferSize, "SLOWEST %d TESTS", numberOfCases);
+  quiz_print(buffer);
+  // Selection of the slowest results, the report is small enough
+  static bool sPrinted[k_quizReportMaxNumberOfCases];
+  for (int i = 0; i < sNumberOfResults; i++) {
+    sPrinted[i] = false;
+  }
+  for (int k = 0; k < numberOfCases && k < sNumberOfResults; k++) {
+    int slowest = -1;
+    for (int i = 0; i < sNumberOfResults; i++) {
+      if (!sPrinted[i] && (slowest < 0 || sResults[i].durationUs > sResults[slowest].durationUs)) {
+        slowest = i;
+      }
+    }
+    sPrinted[slowest] = true;
+    snprintf(buffer, k_bufferSize, "%10llu us  %s", static_cast<unsigned long long>(sResults[slowest].durationUs), quiz_case_names[sResults[slowest].caseIndex]);
+    quiz_print(buffer);
+  }
+}
+
+bool quiz_report_write_json(const char * path, uint64_t durationUs) {
+  FILE * file = fopen(path, "w");
+  if (file == nullptr) {
+    return false;
+  }
+  fprintf(file, "{\n  \"tests\": %d,\n  \"failures\": %d,\n  \"skipped\": %d,\n  \"duration_us\": %llu,\n  \"cases\": [",
+      sNumberOfResults,
+      quiz_report_number_of_cases_with_status(QuizCaseStatus::Failed),
+      quiz_report_number_of_cases_with_status(QuizCaseStatus::Skipped),
+      static_cast<unsigned long long>(durationUs));
+  for (int i = 0; i < sNumberOfResults; i++) {
+    fprintf(file, "%s\n    {\"name\": \"%s\", \"status\": \"%s\", \"duration_us\": %llu}",
+        i == 0 ? "" : ",",
+        quiz_case_names[sResults[i].caseIndex],
+        statusName(sResults[i].status),
+        static_cast<unsigned long long>(sResults[i].durationUs));
+  }
+  fprintf(file, "\n  ]\n}\n");
+  return fclose(file) == 0;
+}
+
+bool quiz_report_write_junit(const char * path, uint64_t durationUs) {
+  FILE * file = fopen(path, "w");
+  if (file == nullptr) {
+    return false;
+  }
+  fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuite name=\"quiz\" tests=\"%d\" failures=\"%d\" skipped=\"%d\" time=\"%.6f\">\n",
+      sNumberOfResults,
+      quiz_report_number_of_cases_with_status(QuizCaseStatus::Failed),
+      quiz_report_number_of_cases_with_status(QuizCaseStatus::Skipped),
+      durationUs / 1e6);
+  for (int i = 0; i < sNumberOfResults; i++) {
+    fprintf(file, "  <testcase name=\"%s\" time=\"%.6f\"", quiz_case_names[sResults[i].caseIndex], sResults[i].durationUs / 1e6);
+    switch (sResults[i].status) {
+    case QuizCaseStatus::Passed:
+      fprintf(file, "/>\n");
+      break;
+    case QuizCaseStatus::Failed:
+      fprintf(file, ">\n    <failure message=\"assertion failed\"/>\n  </testcase>\n");
+      break;
+    default:
+      assert(sResults[i].status == QuizCaseStatus::Skipped);
+      fprintf(file, ">\n    <skipped/>\n  </testcase>\n");
+    }
+  }
+  fprintf(file, "</testsuite>\n");
+  return fclose(file) == 0;
+}
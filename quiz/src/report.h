@@ -0,0 +1,29 @@
+#ifndef QUIZ_REPORT_H
+#define QUIZ_REPORT_H
+
+#include <stdint.h>
+
+/* The report gathers the results of the quiz cases run on the simulator, to
+ * print the slowest ones and write machine-readable summaries. */
+
+constexpr int k_quizReportMaxNumberOfCases = 2048;
+
+enum class QuizCaseStatus : uint8_t {
+  Passed,
+  Failed,
+  // The case was not run because a previous case of its shard aborted
+  Skipped
+};
+
+void quiz_report_reset();
+void quiz_report_add(int caseIndex, uint64_t durationUs, QuizCaseStatus status);
+int quiz_report_number_of_cases_with_status(QuizCaseStatus status);
+void quiz_report_print_failures();
+void quiz_report_print_slowest(int numberOfCases);
+bool quiz_report_write_json(const char * path, uint64_t durationUs);
+bool quiz_report_write_junit(const char * path, uint64_t durationUs);
+/* Defined by the runner, called before aborting on a failed assertion so that
+ * the reports are written with the current case marked failed. */
+void quiz_report_current_case_failed();
+
+#endif
@@ -5,6 +5,17 @@
 #include <poincare/tree_pool.h>
 #include <poincare/exception_checkpoint.h>
 #include <poincare/print.h>
+#if !PLATFORM_DEVICE
+#include "bench.h"
+#include "report.h"
+#include <stdio.h>
+#include <stdlib.h>
+#if (__linux__ || __APPLE__) && !__EMSCRIPTEN__
+#define QUIZ_SHARDS_IN_PROCESSES 1
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#endif
 
 void quiz_print(const char * message) {
   Ion::Console::writeLine(message);
@@ -14,15 +25,82 @@ bool quiz_print_clear() {
   return Ion::Console::clear();
 }
 
+#if POINCARE_TREE_STATS
+static bool sLogTreePoolStatistics = false;
+#endif
+
+#if !PLATFORM_DEVICE
+/* Cases passing the filter are dealt to the shards in turn. The shard index
+ * and count are set by --shard, or by --jobs for each worker process. */
+static int sShardIndex = 0;
+static int sNumberOfShards = 1;
+static int sNumberOfJobs = 1;
+static int sNumberOfSlowestCases = 0;
+static const char * sJSONReportPath = nullptr;
+static const char * sJUnitReportPath = nullptr;
+/* Worker processes record the cases they start and end in this file, so that
+ * the parent can tell which case crashed. */
+static FILE * sShardRecords = nullptr;
+static bool sRunBenches = false;
+// Case being run by ion_main_inner, to report it if an assertion aborts it
+static int sCurrentCaseIndex = -1;
+static uint64_t sCurrentCaseStartTime = 0;
+static uint64_t sStartTime = 0;
+static const char * sTestFilter = nullptr;
+
+static bool caseMatchesFilter(int i, const char * testFilter) {
+  return !testFilter || strstr(quiz_case_names[i], testFilter) == quiz_case_names[i];
+}
+
+static void reportResults(uint64_t durationUs) {
+  quiz_report_print_failures();
+  if (sNumberOfSlowestCases > 0) {
+    quiz_report_print_slowest(sNumberOfSlowestCases);
+  }
+  if (sJSONReportPath && !quiz_report_write_json(sJSONReportPath, durationUs)) {
+    quiz_print("COULD NOT WRITE JSON REPORT");
+  }
+  if (sJUnitReportPath && !quiz_report_write_junit(sJUnitReportPath, durationUs)) {
+    quiz_print("COULD NOT WRITE JUNIT REPORT");
+  }
+}
+
+void quiz_report_current_case_failed() {
+  /* Workers do not write reports: their parent marks the case they were
+   * running as failed when they exit. */
+  if (sCurrentCaseIndex < 0 || sShardRecords != nullptr) {
+    return;
+  }
+  uint64_t now = Ion::Timing::micros();
+  quiz_report_add(sCurrentCaseIndex, now - sCurrentCaseStartTime, QuizCaseStatus::Failed);
+  // The following cases will not be run
+  int filteredIndex = 0;
+  for (int i = 0; quiz_cases[i] != NULL; i++) {
+    if (caseMatchesFilter(i, sTestFilter) && filteredIndex++ % sNumberOfShards == sShardIndex && i > sCurrentCaseIndex) {
+      quiz_report_add(i, 0, QuizCaseStatus::Skipped);
+    }
+  }
+  sCurrentCaseIndex = -1;
+  reportResults(now - sStartTime);
+}
+#endif
+
 static inline void ion_main_inner(const char * testFilter) {
   int i = 0;
   int time = Ion::Timing::millis();
   int totalCases = 0;
+  bool isWorker = false;
+#if !PLATFORM_DEVICE
+  sStartTime = Ion::Timing::micros();
+  sTestFilter = testFilter;
+  int filteredIndex = 0;
+  isWorker = sShardRecords != nullptr;
+#endif
 
   // First pass to count the number of quiz cases
   while (quiz_cases[i] != NULL) {
 #ifndef PLATFORM_DEVICE
-    if (testFilter && strstr(quiz_case_names[i], testFilter) != quiz_case_names[i]) {
+    if (!caseMatchesFilter(i, testFilter) || filteredIndex++ % sNumberOfShards != sShardIndex) {
       i++;
       continue;
     }
@@ -36,28 +114,67 @@ static inline void ion_main_inner(const char * testFilter) {
   char buffer[k_bufferSize];
   i = 0;
   int caseIndex = 0;
+#if !PLATFORM_DEVICE
+  filteredIndex = 0;
+#endif
   while (quiz_cases[i] != NULL) {
 #ifndef PLATFORM_DEVICE
-    if (testFilter && strstr(quiz_case_names[i], testFilter) != quiz_case_names[i]) {
+    if (!caseMatchesFilter(i, testFilter) || filteredIndex++ % sNumberOfShards != sShardIndex) {
       i++;
       continue;
     }
 #endif
     caseIndex++;
     QuizCase c = quiz_cases[i];
-    if (quiz_print_clear()) {
-      // Avoid cluttering the display if it can't be cleared
-      Poincare::Print::CustomPrintf(buffer, k_bufferSize, "TEST: %i/%i", caseIndex, totalCases);
-      quiz_print(buffer);
+#if !PLATFORM_DEVICE
+    if (isWorker) {
+      fprintf(sShardRecords, "S %d\n", i);
+      fflush(sShardRecords);
+    }
+#endif
+    if (!isWorker) {
+      if (quiz_print_clear()) {
+        // Avoid cluttering the display if it can't be cleared
+        Poincare::Print::CustomPrintf(buffer, k_bufferSize, "TEST: %i/%i", caseIndex, totalCases);
+        quiz_print(buffer);
+      }
+      quiz_print(quiz_case_names[i]);
     }
-    quiz_print(quiz_case_names[i]);
+#if !PLATFORM_DEVICE
+    sCurrentCaseIndex = i;
+    sCurrentCaseStartTime = Ion::Timing::micros();
+#endif
+    int numberOfFailedAssertions = sNumberOfFailedAssertions;
     int initialPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
     quiz_assert(initialPoolSize == 0);
+#if POINCARE_TREE_STATS
+    Poincare::TreePool::sharedPool()->resetStatistics();
+#endif
     c();
+#if POINCARE_TREE_STATS
+    if (sLogTreePoolStatistics) {
+      Poincare::TreePool::sharedPool()->statisticsLog(std::cout, false);
+    }
+#endif
     int currentPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
     quiz_assert(initialPoolSize == currentPoolSize);
+#if !PLATFORM_DEVICE
+    uint64_t caseDuration = Ion::Timing::micros() - sCurrentCaseStartTime;
+    // Assertions may have failed without aborting with --skip-assertions
+    bool failed = sNumberOfFailedAssertions != numberOfFailedAssertions;
+    quiz_report_add(i, caseDuration, failed ? QuizCaseStatus::Failed : QuizCaseStatus::Passed);
+    sCurrentCaseIndex = -1;
+    if (isWorker) {
+      fprintf(sShardRecords, "E %d %llu %d\n", i, static_cast<unsigned long long>(caseDuration), failed);
+    }
+#else
+    (void)numberOfFailedAssertions;
+#endif
     i++;
   }
+  if (isWorker) {
+    return;
+  }
   quiz_print_clear();
 
   // Display test results
@@ -68,6 +185,9 @@ static inline void ion_main_inner(const char * testFilter) {
   time = Ion::Timing::millis() - time;
   Poincare::Print::CustomPrintf(buffer, k_bufferSize, "DURATION: %i ms", time);
   quiz_print(buffer);
+#if !PLATFORM_DEVICE
+  reportResults(Ion::Timing::micros() - sStartTime);
+#endif
 #ifdef PLATFORM_DEVICE
   while (1) {
     Ion::Timing::msleep(100000);
@@ -75,6 +195,86 @@ static inline void ion_main_inner(const char * testFilter) {
 #endif
 }
 
+#if QUIZ_SHARDS_IN_PROCESSES
+static void runShardsInProcesses(const char * testFilter) {
+  constexpr int k_maxNumberOfJobs = 64;
+  if (sNumberOfJobs > k_maxNumberOfJobs) {
+    sNumberOfJobs = k_maxNumberOfJobs;
+  }
+  uint64_t startTime = Ion::Timing::micros();
+  FILE * records[k_maxNumberOfJobs];
+  pid_t workers[k_maxNumberOfJobs];
+  fflush(stdout);
+  for (int k = 0; k < sNumberOfJobs; k++) {
+    records[k] = tmpfile();
+    quiz_assert(records[k] != nullptr);
+    workers[k] = fork();
+    quiz_assert(workers[k] >= 0);
+    if (workers[k] == 0) {
+      sShardIndex = k;
+      sNumberOfShards = sNumberOfJobs;
+      sShardRecords = records[k];
+      ion_main_inner(testFilter);
+      fflush(sShardRecords);
+      _exit(0);
+    }
+  }
+
+  quiz_report_reset();
+  static bool sCaseWasRun[k_quizReportMaxNumberOfCases];
+  for (int i = 0; i < k_quizReportMaxNumberOfCases; i++) {
+    sCaseWasRun[i] = false;
+  }
+  bool workersSucceeded = true;
+  for (int k = 0; k < sNumberOfJobs; k++) {
+    int status;
+    waitpid(workers[k], &status, 0);
+    workersSucceeded = workersSucceeded && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    rewind(records[k]);
+    char record;
+    int caseIndex;
+    int lastStartedCase = -1;
+    while (fscanf(records[k], " %c %d", &record, &caseIndex) == 2 && caseIndex >= 0 && caseIndex < k_quizReportMaxNumberOfCases) {
+      sCaseWasRun[caseIndex] = true;
+      if (record == 'S') {
+        lastStartedCase = caseIndex;
+        continue;
+      }
+      unsigned long long duration = 0;
+      int failed = 0;
+      fscanf(records[k], "%llu %d", &duration, &failed);
+      quiz_report_add(caseIndex, duration, failed ? QuizCaseStatus::Failed : QuizCaseStatus::Passed);
+      lastStartedCase = -1;
+    }
+    if (lastStartedCase >= 0) {
+      quiz_report_add(lastStartedCase, 0, QuizCaseStatus::Failed);
+    }
+    fclose(records[k]);
+  }
+
+  // Cases after a crash in their shard were never started
+  int filteredIndex = 0;
+  for (int i = 0; quiz_cases[i] != NULL && i < k_quizReportMaxNumberOfCases; i++) {
+    if (!caseMatchesFilter(i, testFilter)) {
+      continue;
+    }
+    if (!sCaseWasRun[i]) {
+      quiz_report_add(i, 0, QuizCaseStatus::Skipped);
+    }
+    filteredIndex++;
+  }
+
+  constexpr int k_bufferSize = 64;
+  char buffer[k_bufferSize];
+  uint64_t duration = Ion::Timing::micros() - startTime;
+  Poincare::Print::CustomPrintf(buffer, k_bufferSize, "ALL %i TESTS FINISHED IN %i PROCESSES", quiz_report_number_of_cases_with_status(QuizCaseStatus::Passed), sNumberOfJobs);
+  quiz_print(buffer);
+  Poincare::Print::CustomPrintf(buffer, k_bufferSize, "DURATION: %i ms", static_cast<int>(duration / 1000));
+  quiz_print(buffer);
+  reportResults(duration);
+  quiz_assert(workersSucceeded && quiz_report_number_of_cases_with_status(QuizCaseStatus::Passed) == filteredIndex);
+}
+#endif
 
 void ion_main(int argc, const char * const argv[]) {
   Poincare::Init(); // Initialize Poincare::TreePool::sharedPool
@@ -87,7 +287,29 @@ void ion_main(int argc, const char * const argv[]) {
       testFilter = argv[i+1];
     } else if (strcmp(argv[i], "--skip-assertions") == 0) {
       sSkipAssertions = true;
+    } else if (strcmp(argv[i], "--shard") == 0 && i+1 < argc) {
+      // --shard K/N runs the K-th out of N shards, K starting at 0
+      if (sscanf(argv[i+1], "%d/%d", &sShardIndex, &sNumberOfShards) != 2 || sNumberOfShards < 1 || sShardIndex < 0 || sShardIndex >= sNumberOfShards) {
+        sShardIndex = 0;
+        sNumberOfShards = 1;
+      }
+    } else if (strcmp(argv[i], "--jobs") == 0 && i+1 < argc) {
+      sNumberOfJobs = atoi(argv[i+1]);
+    } else if (strcmp(argv[i], "--slowest") == 0 && i+1 < argc) {
+      sNumberOfSlowestCases = atoi(argv[i+1]);
+    } else if (strcmp(argv[i], "--json") == 0 && i+1 < argc) {
+      sJSONReportPath = argv[i+1];
+    } else if (strcmp(argv[i], "--junit") == 0 && i+1 < argc) {
+      sJUnitReportPath = argv[i+1];
+    } else if (strcmp(argv[i], "--bench") == 0) {
+      // Run the QUIZ_BENCH instead of the QUIZ_CASE
+      sRunBenches = true;
+    }
+#if POINCARE_TREE_STATS
+    else if (strcmp(argv[i], "--tree-pool-stats") == 0) {
+      sLogTreePoolStatistics = true;
     }
+#endif
   }
   /* s_stackStart must be defined as early as possible to ensure that there
    * cannot be allocated memory pointers before. Otherwise, with MicroPython for
@@ -98,6 +320,18 @@ void ion_main(int argc, const char * const argv[]) {
 #endif
   Poincare::ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
+#if !PLATFORM_DEVICE
+    if (sRunBenches) {
+      quiz_run_benches(testFilter);
+      return;
+    }
+#endif
+#if QUIZ_SHARDS_IN_PROCESSES
+    if (sNumberOfJobs > 1) {
+      runShardsInProcesses(testFilter);
+      return;
+    }
+#endif
     ion_main_inner(testFilter);
   } else {
     // There has been a memory allocation problem
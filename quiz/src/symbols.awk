@@ -7,6 +7,7 @@ BEGIN {
 #FIXME: Is there a way to capture subexpression in awk? The following gsub is
 #       kind of ugly
 /QUIZ_CASE\(([a-z0-9_]+)\)/ { gsub(/(QUIZ_CASE\()|(\))/, "", $1); tests = tests "quiz_case_" $1 "," }
+/QUIZ_BENCH\(([a-z0-9_]+)\)/ { gsub(/(QUIZ_BENCH\()|(\))/, "", $1); benches = benches "quiz_bench_" $1 "," }
 
 END {
   declarations = tests;
@@ -30,4 +31,27 @@ END {
   names = names "  NULL"
   print names;
   print "};"
+  print ""
+
+  declarations = benches;
+  gsub(/quiz_bench/, "void quiz_bench", declarations);
+  gsub(/,/, "();\n", declarations);
+  print declarations;
+
+  symbols = benches;
+  print "QuizCase quiz_benches[] = {";
+  gsub(/quiz_bench/, "  quiz_bench", symbols);
+  gsub(/,/, ",\n", symbols);
+  symbols = symbols "  NULL"
+  print symbols;
+  print "};"
+  print ""
+
+  names = benches;
+  print "char * quiz_bench_names[] = {";
+  gsub(/quiz_bench_/, "  \"", names);
+  gsub(/,/, "\",\n", names);
+  names = names "  NULL"
+  print names;
+  print "};"
 }
@@ -2,3 +2,5 @@ typedef void (*QuizCase)(void);
 
 extern QuizCase quiz_cases[];
 extern char * quiz_case_names[];
+extern QuizCase quiz_benches[];
+extern char * quiz_bench_names[];